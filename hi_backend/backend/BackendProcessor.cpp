@@ -587,6 +587,18 @@ BackendProcessor::BackendProcessor(AudioDeviceManager *deviceManager_/*=nullptr*
 
 	dllManager = new BackendDllManager(this);
 
+#if HISE_INCLUDE_SNEX && SNEX_MIR_BACKEND
+	{
+		WeakReference<Processor> chain = synthChain.get();
+
+		snex::mir::MirModuleCache::setCacheDirectory(ProjectHandler::getAppDataDirectory(this).getChildFile("SnexCache"), GlobalSettingManager::getHiseVersion(), [chain](const String& m)
+		{
+			if (chain != nullptr)
+				chain->getMainController()->writeToConsole(m, 0, chain.get());
+		});
+	}
+#endif
+
 	if(getCurrentFileHandler().getRootFolder().isDirectory())
 		refreshExpansionType();
 
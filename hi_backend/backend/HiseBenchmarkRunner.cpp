@@ -0,0 +1,432 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   ===========================================================================
+*/
+
+#if JUCE_MAC || JUCE_LINUX
+#include <sys/resource.h>
+#endif
+
+namespace hise { using namespace juce;
+
+struct HiseBenchmarkRunner::Renderer: public AudioRendererBase
+#if HISE_INCLUDE_PROFILING_TOOLKIT
+									, public DebugSession::ScopeObserver
+#endif
+{
+	struct ScopeStatistics
+	{
+		String name;
+		int64 numCalls = 0;
+		double totalMilliseconds = 0.0;
+		double peakMilliseconds = 0.0;
+	};
+
+	Renderer(MainController* mc, const Array<HiseEvent>& events):
+	  AudioRendererBase(mc)
+	{
+		eventBuffers.add(new HiseEventBuffer());
+
+		for (const auto& e : events)
+		{
+			eventBuffers.getLast()->addEvent(e);
+
+			if (eventBuffers.getLast()->getNumUsed() == HISE_EVENT_BUFFER_SIZE)
+				eventBuffers.add(new HiseEventBuffer());
+		}
+
+#if HISE_INCLUDE_PROFILING_TOOLKIT
+		scopeStack.reserve(DebugSession::StackSize);
+		mc->getMainSynthChain()->setEnableProfiling(true, &mc->getDebugSession(), 0);
+		mc->getDebugSession().setScopeObserver(this);
+#endif
+	}
+
+	~Renderer() override
+	{
+		stopThread(1000);
+
+#if HISE_INCLUDE_PROFILING_TOOLKIT
+		getMainController()->getDebugSession().setScopeObserver(nullptr);
+		getMainController()->getMainSynthChain()->setEnableProfiling(false, &getMainController()->getDebugSession(), 0);
+#endif
+	}
+
+	bool start()
+	{
+		initAfterFillingEventBuffer();
+		return isThreadRunning();
+	}
+
+	void callUpdateCallback(bool isFinished, double) override
+	{
+		finished |= isFinished;
+	}
+
+	void onBlockRendered(int numSamples, double processingTimeMilliseconds) override
+	{
+		auto mc = getMainController();
+
+		auto blockDuration = (double)numSamples / mc->getMainSynthChain()->getSampleRate() * 1000.0;
+		auto cpu = blockDuration > 0.0 ? processingTimeMilliseconds / blockDuration * 100.0 : 0.0;
+		auto numVoices = mc->getNumActiveVoices();
+		auto diskUsage = mc->getSampleManager().getGlobalSampleThreadPool()->getDiskUsage() * 100.0;
+
+		numBlocks++;
+		numRenderedSamples += numSamples;
+
+		totalMilliseconds += processingTimeMilliseconds;
+		peakBlockMilliseconds = jmax(peakBlockMilliseconds, processingTimeMilliseconds);
+		peakCpuUsage = jmax(peakCpuUsage, cpu);
+
+		voiceSum += numVoices;
+		peakVoices = jmax(peakVoices, numVoices);
+
+		diskUsageSum += diskUsage;
+		peakDiskUsage = jmax(peakDiskUsage, diskUsage);
+	}
+
+#if HISE_INCLUDE_PROFILING_TOOLKIT
+	void onScopeStart(DebugSession::ProfileDataSource* source) override
+	{
+		// Ignore the scopes from other threads (scripting / UI callbacks)
+		if (Thread::getCurrentThreadId() != getThreadId())
+			return;
+
+		scopeStack.push_back({ source, Time::getHighResolutionTicks() });
+	}
+
+	void onScopeEnd(DebugSession::ProfileDataSource* source) override
+	{
+		if (Thread::getCurrentThreadId() != getThreadId() || scopeStack.empty())
+			return;
+
+		auto item = scopeStack.back();
+		scopeStack.pop_back();
+
+		jassert(item.first == source);
+
+		auto delta = Time::highResolutionTicksToSeconds(Time::getHighResolutionTicks() - item.second) * 1000.0;
+
+		auto& s = scopeStatistics[source];
+
+		if (s.name.isEmpty())
+			s.name = source->name;
+
+		s.numCalls++;
+		s.totalMilliseconds += delta;
+		s.peakMilliseconds = jmax(s.peakMilliseconds, delta);
+	}
+#endif
+
+	var getProcessorStatistics(double renderedMilliseconds) const
+	{
+		Array<var> list;
+
+#if HISE_INCLUDE_PROFILING_TOOLKIT
+		std::vector<ScopeStatistics> sorted;
+
+		for (const auto& s : scopeStatistics)
+			sorted.push_back(s.second);
+
+		std::sort(sorted.begin(), sorted.end(), [](const ScopeStatistics& a, const ScopeStatistics& b)
+		{
+			return a.totalMilliseconds > b.totalMilliseconds;
+		});
+
+		for (const auto& s : sorted)
+		{
+			DynamicObject::Ptr obj = new DynamicObject();
+			obj->setProperty("name", s.name);
+			obj->setProperty("numCalls", s.numCalls);
+			obj->setProperty("totalMs", s.totalMilliseconds);
+			obj->setProperty("peakMs", s.peakMilliseconds);
+			obj->setProperty("cpuUsage", renderedMilliseconds > 0.0 ? s.totalMilliseconds / renderedMilliseconds * 100.0 : 0.0);
+			list.add(var(obj.get()));
+		}
+#else
+		ignoreUnused(renderedMilliseconds);
+#endif
+
+		return var(list);
+	}
+
+	bool finished = false;
+
+	int64 numBlocks = 0;
+	int64 numRenderedSamples = 0;
+	double totalMilliseconds = 0.0;
+	double peakBlockMilliseconds = 0.0;
+	double peakCpuUsage = 0.0;
+
+	int64 voiceSum = 0;
+	int peakVoices = 0;
+
+	double diskUsageSum = 0.0;
+	double peakDiskUsage = 0.0;
+
+#if HISE_INCLUDE_PROFILING_TOOLKIT
+	std::vector<std::pair<DebugSession::ProfileDataSource*, int64>> scopeStack;
+	std::map<DebugSession::ProfileDataSource*, ScopeStatistics> scopeStatistics;
+#endif
+};
+
+HiseBenchmarkRunner::Options HiseBenchmarkRunner::Options::fromCommandLineArguments(const String& blockSizes, const String& sampleRates, const String& numRepetitions)
+{
+	Options o;
+
+	if (blockSizes.isNotEmpty())
+	{
+		o.blockSizes.clear();
+
+		for (auto s : StringArray::fromTokens(blockSizes, ",", ""))
+		{
+			auto bs = s.trim().getIntValue();
+
+			if (bs > 0)
+				o.blockSizes.addIfNotAlreadyThere(bs);
+		}
+	}
+
+	if (sampleRates.isNotEmpty())
+	{
+		o.sampleRates.clear();
+
+		for (auto s : StringArray::fromTokens(sampleRates, ",", ""))
+		{
+			auto sr = s.trim().getDoubleValue();
+
+			if (sr > 0.0)
+				o.sampleRates.addIfNotAlreadyThere(sr);
+		}
+	}
+
+	if (numRepetitions.isNotEmpty())
+		o.numRepetitions = jmax(1, numRepetitions.getIntValue());
+
+	return o;
+}
+
+HiseBenchmarkRunner::HiseBenchmarkRunner(MainController* mc):
+	ControlledObject(mc)
+{}
+
+HiseBenchmarkRunner::~HiseBenchmarkRunner()
+{}
+
+Result HiseBenchmarkRunner::run(const Options& options)
+{
+	if (!options.midiFile.existsAsFile())
+		return Result::fail("The MIDI file " + options.midiFile.getFullPathName() + " does not exist");
+
+	if (options.blockSizes.isEmpty() || options.sampleRates.isEmpty())
+		return Result::fail("You need to specify at least one block size and sample rate");
+
+	DynamicObject::Ptr obj = new DynamicObject();
+
+	obj->setProperty("version", PresetHandler::getVersionString());
+	obj->setProperty("commitHash", String(PREVIOUS_HISE_COMMIT));
+	obj->setProperty("project", GET_PROJECT_HANDLER(getMainController()->getMainSynthChain()).getWorkDirectory().getFullPathName());
+	obj->setProperty("midiFile", options.midiFile.getFullPathName());
+	obj->setProperty("processorTimings", (bool)HISE_INCLUDE_PROFILING_TOOLKIT);
+
+	Array<var> runs;
+
+	auto originalSampleRate = getMainController()->getMainSynthChain()->getSampleRate();
+	auto originalBlockSize = getMainController()->getMainSynthChain()->getLargestBlockSize();
+
+	for (auto sr : options.sampleRates)
+	{
+		for (auto bs : options.blockSizes)
+		{
+			for (int i = 0; i < options.numRepetitions; i++)
+			{
+				auto r = Result::ok();
+				auto thisRun = runSingle(options, sr, bs, r);
+
+				if (r.failed())
+					return r;
+
+				thisRun.getDynamicObject()->setProperty("repetition", i);
+				runs.add(thisRun);
+			}
+		}
+	}
+
+	if (originalSampleRate > 0.0 && originalBlockSize > 0)
+		dynamic_cast<AudioProcessor*>(getMainController())->prepareToPlay(originalSampleRate, originalBlockSize);
+
+	obj->setProperty("peakProcessMemory", getPeakProcessMemory());
+	obj->setProperty("runs", var(runs));
+
+	result = var(obj.get());
+	return Result::ok();
+}
+
+var HiseBenchmarkRunner::runSingle(const Options& options, double sampleRate, int blockSize, Result& r)
+{
+	auto mc = getMainController();
+
+	dynamic_cast<AudioProcessor*>(mc)->prepareToPlay(sampleRate, blockSize);
+
+	MidiFile mf;
+
+	{
+		FileInputStream fis(options.midiFile);
+
+		if (!fis.openedOk() || !mf.readFrom(fis))
+		{
+			r = Result::fail("Can't parse the MIDI file " + options.midiFile.getFullPathName());
+			return {};
+		}
+	}
+
+	HiseMidiSequence::Ptr seq = new HiseMidiSequence();
+	seq->loadFrom(mf);
+
+	auto bpm = seq->getTimeSignature().bpm;
+
+	if (bpm <= 0.0)
+		bpm = options.bpm;
+
+	Array<HiseEvent> events;
+
+	for (int i = 0; i < seq->getNumTracks(); i++)
+	{
+		seq->setCurrentTrackIndex(i);
+		events.addArray(seq->getEventList(sampleRate, bpm, HiseMidiSequence::TimestampEditFormat::Samples));
+	}
+
+	struct TimestampSorter
+	{
+		static int compareElements(const HiseEvent& first, const HiseEvent& second)
+		{
+			auto ft = first.getTimeStamp();
+			auto st = second.getTimeStamp();
+			return ft < st ? -1 : (ft > st ? 1 : 0);
+		}
+	} sorter;
+
+	events.sort(sorter, true);
+
+	if (events.isEmpty())
+	{
+		r = Result::fail("The MIDI file doesn't contain any note or controller events");
+		return {};
+	}
+
+	auto sampleMemoryBefore = getSampleMemory();
+
+	ScopedPointer<Renderer> renderer = new Renderer(mc, events);
+
+	auto start = Time::getMillisecondCounterHiRes();
+
+	if (!renderer->start())
+	{
+		r = Result::fail("Can't start the render thread");
+		return {};
+	}
+
+	renderer->waitForThreadToExit(-1);
+
+	auto wallClock = Time::getMillisecondCounterHiRes() - start;
+
+	if (!renderer->finished)
+	{
+		r = Result::fail("Rendering was aborted");
+		return {};
+	}
+
+	auto renderedMilliseconds = (double)renderer->numRenderedSamples / sampleRate * 1000.0;
+	auto numBlocks = jmax<int64>(1, renderer->numBlocks);
+
+	DynamicObject::Ptr obj = new DynamicObject();
+
+	obj->setProperty("sampleRate", sampleRate);
+	obj->setProperty("blockSize", blockSize);
+	obj->setProperty("bpm", bpm);
+	obj->setProperty("numBlocks", renderer->numBlocks);
+	obj->setProperty("renderedMs", renderedMilliseconds);
+	obj->setProperty("wallClockMs", wallClock);
+
+	DynamicObject::Ptr cpu = new DynamicObject();
+	cpu->setProperty("totalMs", renderer->totalMilliseconds);
+	cpu->setProperty("averageBlockMs", renderer->totalMilliseconds / (double)numBlocks);
+	cpu->setProperty("peakBlockMs", renderer->peakBlockMilliseconds);
+	cpu->setProperty("averageUsage", renderedMilliseconds > 0.0 ? renderer->totalMilliseconds / renderedMilliseconds * 100.0 : 0.0);
+	cpu->setProperty("peakUsage", renderer->peakCpuUsage);
+	cpu->setProperty("realtimeFactor", renderer->totalMilliseconds > 0.0 ? renderedMilliseconds / renderer->totalMilliseconds : 0.0);
+	obj->setProperty("cpu", var(cpu.get()));
+
+	DynamicObject::Ptr voices = new DynamicObject();
+	voices->setProperty("average", (double)renderer->voiceSum / (double)numBlocks);
+	voices->setProperty("peak", renderer->peakVoices);
+	obj->setProperty("voices", var(voices.get()));
+
+	DynamicObject::Ptr streaming = new DynamicObject();
+	streaming->setProperty("averageDiskUsage", renderer->diskUsageSum / (double)numBlocks);
+	streaming->setProperty("peakDiskUsage", renderer->peakDiskUsage);
+	obj->setProperty("streaming", var(streaming.get()));
+
+	DynamicObject::Ptr memory = new DynamicObject();
+	memory->setProperty("sampleMemory", jmax(sampleMemoryBefore, getSampleMemory()));
+	memory->setProperty("peakProcessMemory", getPeakProcessMemory());
+	obj->setProperty("memory", var(memory.get()));
+
+	obj->setProperty("processors", renderer->getProcessorStatistics(renderedMilliseconds));
+
+	renderer = nullptr;
+
+	return var(obj.get());
+}
+
+int64 HiseBenchmarkRunner::getSampleMemory() const
+{
+	auto mc = getMainController();
+	auto bytes = (int64)mc->getSampleManager().getModulatorSamplerSoundPool2()->getMemoryUsageForAllSamples();
+	auto& handler = mc->getExpansionHandler();
+
+	for (int i = 0; i < handler.getNumExpansions(); i++)
+		bytes += (int64)handler.getExpansion(i)->pool->getSamplePool()->getMemoryUsageForAllSamples();
+
+	return bytes;
+}
+
+int64 HiseBenchmarkRunner::getPeakProcessMemory()
+{
+#if JUCE_MAC || JUCE_LINUX
+	struct rusage usage;
+
+	if (getrusage(RUSAGE_SELF, &usage) == 0)
+	{
+#if JUCE_MAC
+		return (int64)usage.ru_maxrss;
+#else
+		// Linux reports the value in kilobytes
+		return (int64)usage.ru_maxrss * 1024;
+#endif
+	}
+
+	return -1;
+#else
+	return -1;
+#endif
+}
+
+} // namespace hise
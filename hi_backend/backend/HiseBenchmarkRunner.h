@@ -0,0 +1,85 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   ===========================================================================
+*/
+
+#pragma once
+
+namespace hise { using namespace juce;
+
+/** Renders a MIDI file offline through the currently loaded project and collects performance data.
+
+    This is used by the `benchmark` command line action to get reproducible numbers that can be
+	diffed between two HISE builds. For every combination of sample rate and block size it will:
+
+	- call prepareToPlay() with the given settings
+	- convert the MIDI file to a HiseEventBuffer with sample timestamps
+	- render it with an AudioRendererBase subclass (the same code path as Engine.renderAudio())
+	- collect the block timings, voice count, streaming thread load and memory usage
+
+	If HISE was built with HISE_INCLUDE_PROFILING_TOOLKIT, it will also accumulate the timings of the
+	ProfiledProcessor scopes (ModulatorSynth::ProfileEnumIds, effect and MIDI processor scopes) by
+	attaching a DebugSession::ScopeObserver during the rendering.
+
+	The result is a JSON object with one entry per run that can be written to a file with toJSONString().
+*/
+struct HiseBenchmarkRunner: public ControlledObject
+{
+	struct Options
+	{
+		/** Parses the comma separated lists from the command line (eg. `-bs:64,512 -sr:44100,48000`). */
+		static Options fromCommandLineArguments(const String& blockSizes, const String& sampleRates, const String& numRepetitions);
+
+		File midiFile;
+		Array<int> blockSizes = { 512 };
+		Array<double> sampleRates = { 44100.0 };
+		double bpm = 120.0;
+		int numRepetitions = 1;
+	};
+
+	HiseBenchmarkRunner(MainController* mc);
+	~HiseBenchmarkRunner();
+
+	/** Renders the MIDI file with every setting combination and returns the result as JSON object.
+
+	    This must be called from the message thread and will block until all runs are finished.
+	*/
+	Result run(const Options& options);
+
+	var getResult() const { return result; }
+
+	String toJSONString() const { return JSON::toString(result, false); }
+
+	/** Returns the peak resident memory of the process in bytes (or -1 if the platform is not supported). */
+	static int64 getPeakProcessMemory();
+
+private:
+
+	struct Renderer;
+
+	var runSingle(const Options& options, double sampleRate, int blockSize, Result& r);
+
+	int64 getSampleMemory() const;
+
+	var result;
+
+	JUCE_DECLARE_NON_COPYABLE(HiseBenchmarkRunner);
+};
+
+} // namespace hise
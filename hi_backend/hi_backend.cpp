@@ -103,6 +103,7 @@
 #include "backend/BackendApplicationCommandWindows.cpp"
 #include "backend/dialog_library/dialog_library.cpp"
 #include "backend/BackendApplicationCommands.cpp"
+#include "backend/HiseBenchmarkRunner.cpp"
 #include "backend/BackendVisualizer.h"
 #include "backend/BackendVisualizer.cpp"
 #include "backend/BackendEditor.cpp"
@@ -81,6 +81,7 @@ If true, then the patch browser will display global modulator connections.
 #include "backend/BackendToolbar.h"
 #include "backend/dialog_library/dialog_library.h"
 #include "backend/HiseCliLauncher.h"
+#include "backend/HiseBenchmarkRunner.h"
 #include "backend/BackendApplicationCommands.h"
 #include "backend/BackendEditor.h"
 #include "backend/BackendRootWindow.h"
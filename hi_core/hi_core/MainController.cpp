@@ -814,7 +814,7 @@ bool MainController::refreshOversampling()
 {
 	auto requiredOversamplingFactor = (double)jlimit(1, 8, nextPowerOfTwo((int)(minimumSamplerate / getOriginalSamplerate())));
 
-	int numChannelsOfOversampler = oversampler != nullptr ? (int)oversampler->numChannels : -1;
+	int numChannelsOfOversampler = oversampler != nullptr ? oversampler->getNumChannels() : -1;
 
 	bool channelsNeedUpdating = numChannelsOfOversampler > 0 && numChannelsOfOversampler != multiChannelBuffer.getNumChannels();
 
@@ -822,12 +822,12 @@ bool MainController::refreshOversampling()
 	{
 		auto f = [this, requiredOversamplingFactor](Processor* p)
 		{
-			ScopedPointer<juce::dsp::Oversampling<float>> newOversampler;
+			ScopedPointer<PolyphaseOversampler> newOversampler;
 			
 			if(requiredOversamplingFactor != 1)
-				newOversampler = new juce::dsp::Oversampling<float>(multiChannelBuffer.getNumChannels(),
-				log2(requiredOversamplingFactor),
-				juce::dsp::Oversampling<float>::FilterType::filterHalfBandPolyphaseIIR);
+				newOversampler = new PolyphaseOversampler(multiChannelBuffer.getNumChannels(),
+				roundToInt(log2(requiredOversamplingFactor)),
+				PolyphaseOversampler::FilterType::PolyphaseIIR);
 
 			{
 				ScopedLock sl(getLock());
@@ -1881,6 +1881,14 @@ void MainController::prepareToPlay(double sampleRate_, int samplesPerBlock)
 	if (oversampler != nullptr)
 		oversampler->initProcessing(getOriginalBufferSize());
 
+	auto newOversamplingLatency = oversampler != nullptr ? roundToInt(oversampler->getLatencyInSamples()) : 0;
+
+	if (newOversamplingLatency != oversamplingLatency && thisAsProcessor != nullptr)
+	{
+		thisAsProcessor->setLatencySamples(thisAsProcessor->getLatencySamples() - oversamplingLatency + newOversamplingLatency);
+		oversamplingLatency = newOversamplingLatency;
+	}
+
 	auto changed = oldBlockSize != processingBufferSize.get() ||
 				   oldSampleRate != processingSampleRate;
 
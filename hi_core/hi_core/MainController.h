@@ -999,6 +999,20 @@ public:
 			useUndoForPresetLoads = shouldAllowUndo;
 		}
 
+		/** Enables the differential preset load.
+
+			If enabled, the preset will be compared with the current state before loading. If only plain
+			control values have changed, they will be restored directly without killing the voices (just
+			like a user would move the controls). Otherwise the preset will be loaded with the usual voice
+			kill, but only the changed controls and module states will be restored.
+		*/
+		void setUseDifferentialLoading(bool shouldUseDifferentialLoading)
+		{
+			useDifferentialLoading = shouldUseDifferentialLoading;
+		}
+
+		bool isUsingDifferentialLoading() const { return useDifferentialLoading; }
+
 		void preprocess(ValueTree& presetToLoad);
 
 		void postPresetLoad();
@@ -1078,17 +1092,34 @@ public:
 
 		SharedResourcePointer<TagDataBase> tagDataBase;
 
+		/** The changes between the preset that is about to be loaded and the current state. */
+		struct PresetDiff
+		{
+			bool requiresVoiceKill() const { return !onlyPlainValues || stateChanged || !changedModules.isEmpty(); }
+
+			bool isValid = false;
+			bool onlyPlainValues = true;
+			bool stateChanged = false;
+			Array<int> changedComponents;
+			StringArray changedModules;
+		};
+
+		PresetDiff createPresetDiff(const ValueTree& newPreset) const;
+
 		void loadUserPresetInternal();
+		void loadUserPresetDifferential();
 		void saveUserPresetInternal(const String& name=String());
 
 		Array<WeakReference<Listener>, CriticalSection> listeners;
 
 		File currentlyLoadedFile;
 		ValueTree pendingPreset;
+		PresetDiff pendingDiff;
 		StringArray storedModuleIds;
 
 		MainController* mc;
 		bool useUndoForPresetLoads = false;
+		bool useDifferentialLoading = false;
 		bool abortCurrentLoad = false;
 
 		struct CustomStateManager : public UserPresetStateManager
@@ -1897,6 +1928,9 @@ public:
 		return refreshOversampling();
 	}
 
+	/** Returns the latency of the global oversampling in samples. This is reported to the host on top of the latency set with Engine.setLatencySamples(). */
+	int getOversamplingLatency() const { return oversamplingLatency; }
+
 	void setMaximumBlockSize(int newBlockSize);
 
 	/** Returns the maximum block size that HISE will use for its process callback. 
@@ -2341,7 +2375,8 @@ private:
 		float characterWidths[128];
 	};
 
-	ScopedPointer<juce::dsp::Oversampling<float>> oversampler;
+	ScopedPointer<PolyphaseOversampler> oversampler;
+	int oversamplingLatency = 0;
 	double minimumSamplerate = 0.0;
 	int maximumBlockSize = HISE_MAX_PROCESSING_BLOCKSIZE;
 	int currentOversampleFactor = 1;
@@ -1736,6 +1736,8 @@ bool AudioRendererBase::renderAudio()
 
 			auto& bufferToUse = numThrowAway > 0 ? nirvana : ab;
 
+			auto blockStart = Time::getHighResolutionTicks();
+
 			// call this directly to avoid messing with the logic that copes with
 			// weird buffer lenghts (this is not multithread-safe like the internal audio rendering)...
 			getMainController()->processBlockCommon(bufferToUse, mb);
@@ -1749,6 +1751,9 @@ bool AudioRendererBase::renderAudio()
 			}
 			else
 			{
+				auto blockTime = Time::highResolutionTicksToSeconds(Time::getHighResolutionTicks() - blockStart) * 1000.0;
+				onBlockRendered(numThisTime, blockTime);
+
 				pos += numThisTime;
 				numTodo -= numThisTime;
 			}
@@ -898,6 +898,16 @@ protected:
 
 	virtual void callUpdateCallback(bool isFinished, double progress) = 0;
 
+	/** Override this method if you need to measure each rendered block. 
+	
+		This will be called on the render thread after each block that ends up in the output 
+		(the throw-away buffers at the start are skipped) with the time spent in the processing call. 
+	*/
+	virtual void onBlockRendered(int numSamples, double processingTimeMilliseconds) 
+	{
+		ignoreUnused(numSamples, processingTimeMilliseconds);
+	}
+
 	/** Call this after creating the Event buffer content and it will prepare all internal buffers. */
 	void initAfterFillingEventBuffer();
 
@@ -508,6 +508,20 @@ void MainController::UserPresetHandler::loadUserPresetFromValueTree(const ValueT
 			return;
 		}
 
+		pendingDiff = {};
+
+		if (useDifferentialLoading)
+		{
+			pendingDiff = createPresetDiff(pendingPreset);
+
+			// Only plain values have changed, so we can restore them without killing the voices
+			if (pendingDiff.isValid && !pendingDiff.requiresVoiceKill())
+			{
+				loadUserPresetDifferential();
+				return;
+			}
+		}
+
 		// Send a note off to stop the arpeggiator etc...
 		mc->allNotesOff(false);
 
@@ -593,6 +607,102 @@ void MainController::UserPresetHandler::saveUserPresetInternal(const String& nam
 	UserPresetHelpers::saveUserPreset(mc->getMainSynthChain(), currentPresetFile.getFullPathName());
 }
 
+MainController::UserPresetHandler::PresetDiff MainController::UserPresetHandler::createPresetDiff(const ValueTree& newPreset) const
+{
+	PresetDiff diff;
+
+#if !USE_RAW_FRONTEND
+	auto jsp = JavascriptMidiProcessor::getFirstInterfaceScriptProcessor(mc);
+
+	// The custom data model is restored by the script, so we can't tell what has changed
+	if (jsp == nullptr || isUsingCustomDataModel())
+		return diff;
+
+	auto currentPreset = UserPresetHelpers::createUserPreset(mc->getMainSynthChain());
+
+	auto toString = [](const ValueTree& v)
+	{
+		if (auto xml = v.createXml())
+			return xml->toString();
+
+		return String();
+	};
+
+	for (auto c : newPreset)
+	{
+		if (c.getProperty("Processor") == jsp->getId())
+		{
+			diff.changedComponents = jsp->getScriptingContent()->getChangedComponentsInPreset(c, diff.onlyPlainValues);
+		}
+		else if (c.getType() == UserPresetIds::Modules)
+		{
+			auto currentModules = currentPreset.getChildWithName(UserPresetIds::Modules);
+
+			for (auto m : c)
+			{
+				auto id = m["ID"].toString();
+
+				if (toString(currentModules.getChildWithProperty("ID", id)) != toString(m))
+					diff.changedModules.add(id);
+			}
+		}
+		else if (toString(currentPreset.getChildWithName(c.getType())) != toString(c))
+		{
+			diff.stateChanged = true;
+		}
+	}
+
+	// A state that doesn't exist in the new preset will be reset
+	for (auto c : currentPreset)
+	{
+		if (!newPreset.getChildWithName(c.getType()).isValid())
+			diff.stateChanged = true;
+	}
+
+	diff.isValid = true;
+#else
+	ignoreUnused(newPreset);
+#endif
+
+	return diff;
+}
+
+void MainController::UserPresetHandler::loadUserPresetDifferential()
+{
+	DebugSession::ProfileDataSource::ScopedProfiler sp(userPresetSource, &mc->getDebugSession());
+	ScopedValueSetter<void*> svs(currentThreadThatIsLoadingPreset, LockHelpers::getCurrentThreadHandleOrMessageManager());
+
+	timeOfLastPresetLoad = Time::getMillisecondCounter();
+
+#if !USE_RAW_FRONTEND
+	if (auto jsp = JavascriptMidiProcessor::getFirstInterfaceScriptProcessor(mc))
+	{
+		for (auto c : pendingPreset)
+		{
+			if (c.getProperty("Processor") == jsp->getId())
+			{
+				// This will defer the control callbacks to the scripting thread just like a regular UI change
+				jsp->getScriptingContent()->restoreControlsFromPreset(c, pendingDiff.changedComponents);
+				break;
+			}
+		}
+
+		// The listeners must be notified after the deferred control callbacks, so we
+		// add it to the same queue (or run it right away if they were executed synchronously)
+		auto f = [this](JavascriptProcessor*)
+		{
+			postPresetLoad();
+			return Result::ok();
+		};
+
+		mc->getJavascriptThreadPool().addJob(JavascriptThreadPool::Task::HiPriorityCallbackExecution, jsp, f);
+		return;
+	}
+#endif
+
+	postPresetLoad();
+}
+
 void MainController::UserPresetHandler::loadUserPresetInternal()
 {
 	DebugSession::ProfileDataSource::ScopedProfiler sp(userPresetSource, &mc->getDebugSession());
@@ -611,6 +721,26 @@ void MainController::UserPresetHandler::loadUserPresetInternal()
 
 		jassert(userPresetToLoad.isValid());
 
+		PresetDiff diff;
+
+		// The voices are stopped now, so we need to compare it again with the state that the preset is applied to
+		if (pendingDiff.isValid)
+			diff = createPresetDiff(userPresetToLoad);
+
+		// Only restore the module states that have changed
+		if (diff.isValid)
+		{
+			userPresetToLoad = userPresetToLoad.createCopy();
+
+			auto modules = userPresetToLoad.getChildWithName(UserPresetIds::Modules);
+
+			for (int i = 0; i < modules.getNumChildren(); i++)
+			{
+				if (!diff.changedModules.contains(modules.getChild(i)["ID"].toString()))
+					modules.removeChild(i--, nullptr);
+			}
+		}
+
 		mc->getSampleManager().setShouldSkipPreloading(true);
 
 		auto userPresetState = isInternalPresetLoad() ?
@@ -665,7 +795,12 @@ void MainController::UserPresetHandler::loadUserPresetInternal()
 					}
 
 					if (v.isValid())
-						sp->getScriptingContent()->restoreAllControlsFromPreset(v);
+					{
+						if (diff.isValid)
+							sp->getScriptingContent()->restoreControlsFromPreset(v, diff.changedComponents);
+						else
+							sp->getScriptingContent()->restoreAllControlsFromPreset(v);
+					}
 				}
 			}
 		}
@@ -68,6 +68,10 @@ public:
 
 	virtual ~EffectProcessor();;
 
+#if HISE_INCLUDE_LIGHTWEIGHT_TRACER && !HISE_INCLUDE_PROFILING_TOOLKIT
+	String getTraceScopeName(int) const override { return getId(); }
+#endif
+
 	/** Renders all chains (envelopes & voicestart are rendered monophonically. */
 	void renderAllChains(int startSample, int numSamples);
 
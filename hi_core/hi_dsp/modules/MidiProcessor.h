@@ -57,6 +57,10 @@ public:
 	MidiProcessor(MainController *m, const String &id);
 	virtual ~MidiProcessor();
 
+#if HISE_INCLUDE_LIGHTWEIGHT_TRACER && !HISE_INCLUDE_PROFILING_TOOLKIT
+	String getTraceScopeName(int eventType) const override { return getId() + " (" + HiseEvent::getTypeString((HiseEvent::Type)eventType) + ")"; }
+#endif
+
 	void setIndexInChain(int chainIndex) noexcept;
     int getIndexInChain() const noexcept;
 
@@ -237,6 +237,22 @@ int ModulatorSynth::getNumChildProcessors() const
 int ModulatorSynth::getNumInternalChains() const
 { return numInternalChains; }
 
+#if HISE_INCLUDE_LIGHTWEIGHT_TRACER && !HISE_INCLUDE_PROFILING_TOOLKIT
+String ModulatorSynth::getTraceScopeName(int scopeIndex) const
+{
+	switch ((ProfileEnumIds)scopeIndex)
+	{
+	case ProfileEnumIds::ProcessBlock:		return getId();
+	case ProfileEnumIds::ProcessMidi:		return getId() + " (MIDI)";
+	case ProfileEnumIds::RenderVoices:		return getId() + " (Voices)";
+	case ProfileEnumIds::RenderVoice:		return getId() + " (Voice)";
+	case ProfileEnumIds::RenderFX:			return getId() + " (FX)";
+	case ProfileEnumIds::RenderChildSynths:	return getId() + " (Child synths)";
+	default:								return getId();
+	}
+}
+#endif
+
 void ModulatorSynth::setIconColour(Colour newIconColour)
 { 
 	iconColour = newIconColour;
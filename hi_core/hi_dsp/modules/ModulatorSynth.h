@@ -155,6 +155,10 @@ public:
 	int getNumChildProcessors() const override;;
 	int getNumInternalChains() const override;;
 
+#if HISE_INCLUDE_LIGHTWEIGHT_TRACER && !HISE_INCLUDE_PROFILING_TOOLKIT
+	String getTraceScopeName(int scopeIndex) const override;
+#endif
+
 	// ===================================================================================================================
 
 	int getFreeTimerSlot();
@@ -284,6 +288,9 @@ public:
 
 	virtual void setVoiceLimit(int newVoiceLimit);
 
+	/** Returns the maximum amount of voices that can play at the same time (the voice limit scaled by the voice amount multiplier). */
+	int getInternalVoiceLimit() const noexcept { return internalVoiceLimit; }
+
 	void setKillFadeOutTime(double fadeTimeSeconds);
 
 		/** Checks if the message fits the sound, but can be overriden to implement other group start logic. */
@@ -507,7 +507,7 @@ void ShapeFX::updateOversampling()
     auto factor = 0;
 #endif
 
-    ScopedPointer<Oversampler> newOverSampler = new Oversampler(2, factor, Oversampler::FilterType::filterHalfBandPolyphaseIIR, false);
+    ScopedPointer<Oversampler> newOverSampler = new Oversampler(2, factor, Oversampler::FilterType::PolyphaseIIR);
 
 	if (getLargestBlockSize() > 0)
 		newOverSampler->initProcessing(getLargestBlockSize());
@@ -726,17 +726,17 @@ PolyshapeFX::PolyshapeFX(MainController *mc, const String &uid, int numVoices):
 
 	connectWaveformUpdaterToComplexUI(getDisplayBuffer(0), true);
 
-	for (int i = 0; i < numVoices; i++)
-	{
 #if HI_ENABLE_SHAPE_FX_OVERSAMPLER
-        auto factor = 2;
+	auto factor = 2;
 #else
-        auto factor = 0;
+	auto factor = 0;
 #endif
-        
-		oversamplers.add(new ShapeFX::Oversampler(2, factor, ShapeFX::Oversampler::FilterType::filterHalfBandPolyphaseIIR, false));
+
+	// one oversampler that keeps the filter state of all voices
+	oversampler = new ShapeFX::Oversampler(2, factor, ShapeFX::Oversampler::FilterType::PolyphaseIIR, numVoices);
+
+	for (int i = 0; i < numVoices; i++)
 		driveSmoothers[i] = LinearSmoothedValue<float>(0.0f);
-	}
 
 	initShapers();
 
@@ -754,7 +754,7 @@ PolyshapeFX::~PolyshapeFX()
 	tableUpdater = nullptr;
 	shapers.clear();
 	
-	oversamplers.clear();
+	oversampler = nullptr;
 }
 
 float PolyshapeFX::getAttribute(int parameterIndex) const
@@ -838,11 +838,7 @@ void PolyshapeFX::prepareToPlay(double sampleRate, int samplesPerBlock)
 		driveSmoothers[i].reset(sampleRate, 0.05);
 	}
 
-	for (auto os : oversamplers)
-	{
-		os->initProcessing(samplesPerBlock);
-		os->reset();
-	}
+	oversampler->initProcessing(samplesPerBlock);
 
 	for (auto& dc : dcRemovers)
 	{
@@ -913,9 +909,9 @@ void PolyshapeFX::applyEffect(int voiceIndex, AudioSampleBuffer &b, int startSam
 	{
 		dsp::AudioBlock<float> block(b.getArrayOfWritePointers(), 2, startSample, numSamples);
 
-		auto os = oversamplers[voiceIndex];
+		oversampler->setVoiceIndex(voiceIndex);
 		
-		dsp::AudioBlock<float> oversampledData = os->processSamplesUp(block);
+		dsp::AudioBlock<float> oversampledData = oversampler->processSamplesUp(block);
 		auto numOversampled = oversampledData.getNumSamples();
 
 		float* o_l = oversampledData.getChannelPointer(0);
@@ -923,7 +919,7 @@ void PolyshapeFX::applyEffect(int voiceIndex, AudioSampleBuffer &b, int startSam
 
 		shapers[mode]->processBlock(o_l, o_r, (int)numOversampled);
 		
-		os->processSamplesDown(block);
+		oversampler->processSamplesDown(block);
 	}
 	else
 	{
@@ -984,6 +980,7 @@ void PolyshapeFX::startVoice(int voiceIndex, const HiseEvent& e)
 	VoiceEffectProcessor::startVoice(voiceIndex, e);
 
 	driveSmoothers[voiceIndex].setValueWithoutSmoothing(drive-1.0f);
+	oversampler->resetVoice(voiceIndex);
 
 }
 
@@ -88,7 +88,7 @@ public:
 
 	static ProcessorMetadata createMetadata();
 
-	using Oversampler = juce::dsp::Oversampling<float>;
+	using Oversampler = PolyphaseOversampler;
     
 	using ShapeFunction = std::function<float(float)>;
 
@@ -482,7 +482,7 @@ private:
 	StringArray shapeNames;
 
 	OwnedArray<ShapeFX::ShaperBase> shapers;
-	OwnedArray<ShapeFX::Oversampler> oversamplers;
+	ScopedPointer<ShapeFX::Oversampler> oversampler;
 	float drive = 1.0f;
 
 	LinearSmoothedValue<float> driveSmoothers[NUM_POLYPHONIC_VOICES];
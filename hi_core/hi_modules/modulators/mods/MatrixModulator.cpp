@@ -374,6 +374,8 @@ MatrixModulator::MatrixModulator(MainController* mc, const String& id, int voice
 
 	}
 
+	program.publish(new ConnectionProgram());
+
 	ModulatorSynthChain *chain = mc->getMainSynthChain();
 
 	chain->getHandler()->addListener(this);
@@ -508,7 +510,9 @@ ValueTree MatrixModulator::exportAsValueTree() const
 
 float MatrixModulator::startVoice(int voiceIndex)
 {
-	if(auto sl = SimpleReadWriteLock::ScopedTryReadLock(matrixLock))
+	ProgramReader p(program);
+
+	if(p)
 	{
 		PolyHandler::ScopedVoiceSetter svs(polyHandler, voiceIndex);
 
@@ -521,10 +525,10 @@ float MatrixModulator::startVoice(int voiceIndex)
 		baseValue.reset();
 		float dv = baseValue.get();
 
-		for(auto m: allMods)
+		for(const auto& c: p->connections)
 		{
-			m->handleHiseEvent(e);
-			m->calculateVoiceStart(dv);
+			c.mod->handleHiseEvent(e);
+			c.mod->calculateVoiceStart(dv);
 		}
 			
 		return dv;
@@ -549,33 +553,33 @@ void MatrixModulator::reset(int voiceIndex)
 	// will have a continuous stream of samples.
 	if(!isInMonophonicMode())
 	{
-		SimpleReadWriteLock::ScopedReadLock sl(matrixLock);
+		ProgramReader p(program);
 		PolyHandler::ScopedVoiceSetter svs(polyHandler, voiceIndex);
 
-		for(auto m: allMods)
-			m->reset();
+		if(p)
+		{
+			for(const auto& c: p->connections)
+				c.mod->reset();
+		}
 	}
 }
 
 bool MatrixModulator::isPlaying(int voiceIndex) const
 {
-	if(hasScaleEnvelopes)
+	ProgramReader p(program);
+
+	if(p && p->hasScaleEnvelopes)
 	{
-		if(auto sl = SimpleReadWriteLock::ScopedTryReadLock(matrixLock))
-		{
-			PolyHandler::ScopedVoiceSetter svs(polyHandler, voiceIndex);
+		PolyHandler::ScopedVoiceSetter svs(polyHandler, voiceIndex);
 
-			auto ok = true;
+		auto ok = true;
 
-			for(auto m: allMods)
-			{
-				ok &= m->isPlaying();
-			}
-				
-			return ok;
+		for(const auto& c: p->connections)
+		{
+			ok &= c.mod->isPlaying();
 		}
-
-		return false;
+			
+		return ok;
 	}
 	else
 	{
@@ -614,17 +618,17 @@ void MatrixModulator::calculateBlock(int startSample, int numSamples)
 	else
 		FloatVectorOperations::fill(ptr, baseValue.get(), numSamples);
 
-	if(auto sl = SimpleReadWriteLock::ScopedTryReadLock(matrixLock))
+	ProgramReader p(program);
+
+	if(p && !p->isEmpty())
 	{
 		auto voiceIndex = polyManager.getCurrentVoice();
 		scriptnode::PolyHandler::ScopedVoiceSetter sv(polyHandler, voiceIndex);
 		ProcessData<1> pd(&ptr, numSamples, 1);
 
-		for(auto sl: scaleMods)
-			sl->process(pd);
-
-		for(auto al: addMods)
-			al->process(pd);
+		// the scale connections are sorted before the add connections
+		for(const auto& c: p->connections)
+			c.mod->process(pd);
 	}
 
 	if(rangeData.outputRange.isNonDefault())
@@ -644,7 +648,10 @@ ModulationDisplayValue MatrixModulator::getDisplayValue(double nv, NormalisableR
 	ModulationDisplayValue mv;
 	mv.normalisedValue = nr.convertTo0to1(nv);
 	mv.scaledValue = mv.normalisedValue;
-	mv.modulationActive = !allMods.empty();
+	{
+		ProgramReader p(program);
+		mv.modulationActive = p && !p->isEmpty();
+	}
 
 	mv.modulationRange = { mv.normalisedValue, mv.normalisedValue };
 
@@ -673,15 +680,8 @@ void MatrixModulator::rebuildModList()
 {
 	auto signal = container->getMatrixModulatorConnection();
 
-	std::vector<ModType*> newScaleMods;
-	std::vector<ModType*> newAddMods;
-	std::vector<ModType*> newAllMods;
-
-	newScaleMods.reserve(items.size());
-	newAddMods.reserve(items.size());
-	newAllMods.reserve(items.size());
-
-	hasScaleEnvelopes = false;
+	ScopedPointer<ConnectionProgram> newProgram = new ConnectionProgram();
+	newProgram->connections.reserve(items.size());
 
 	if(container != nullptr)
 	{
@@ -694,23 +694,21 @@ void MatrixModulator::rebuildModList()
 				auto mod = dynamic_cast<EnvelopeModulator*>(mc->getChildProcessor(i->sourceIndex));
 
 				auto isPolyphonicScaleMod = mod != nullptr && !mod->isInMonophonicMode();
-				hasScaleEnvelopes |= isPolyphonicScaleMod;
+				newProgram->hasScaleEnvelopes |= isPolyphonicScaleMod;
 			}
 		}
 	}
 
 	for(auto i: items)
 	{
-		if(!i->isConnected())
-			continue;
-
-		auto m = &i->mod;
-		newAllMods.push_back(m);
+		if(i->isConnected() && i->isScale)
+			newProgram->connections.push_back({ &i->mod, true });
+	}
 
-		if(i->isScale)
-			newScaleMods.push_back(m);
-		else
-			newAddMods.push_back(m);
+	for(auto i: items)
+	{
+		if(i->isConnected() && !i->isScale)
+			newProgram->connections.push_back({ &i->mod, false });
 	}
 
 	{
@@ -720,12 +718,7 @@ void MatrixModulator::rebuildModList()
 			i->mod.connectToRuntimeTarget(true, signal);
 	}
 
-	{
-		SimpleReadWriteLock::ScopedWriteLock sl(matrixLock);
-		std::swap(allMods, newAllMods);
-		std::swap(scaleMods, newScaleMods);
-		std::swap(addMods, newAddMods);
-	}
+	program.publish(newProgram.release());
 }
 
 void MatrixModulator::onMatrixChange(const ValueTree& v, bool wasAdded)
@@ -837,7 +830,12 @@ void MatrixModulator::init()
 	{
 		container = gc;
 
+		if(!items.isEmpty())
 		{
+			// make sure that the audio thread doesn't use the old connections anymore
+			program.publish(new ConnectionProgram());
+
+			LockHelpers::SafeLock al(getMainController(), LockHelpers::Type::AudioLock);
 			SimpleReadWriteLock::ScopedWriteLock sl(matrixLock);
 			items.clear();
 		}
@@ -182,6 +182,25 @@ private:
 		SimpleRingBuffer::Ptr displayBuffer;
 	};
 
+	/** A flat list of all connected modulators of this target that is compiled when the matrix changes
+	    and published to the audio thread without locking. The scale connections come first so that
+	    the block can be calculated in a single pass. */
+	struct ConnectionProgram
+	{
+		struct Connection
+		{
+			ModType* mod = nullptr;
+			bool isScale = false;
+		};
+
+		bool isEmpty() const noexcept { return connections.empty(); }
+
+		std::vector<Connection> connections;
+		bool hasScaleEnvelopes = false;
+	};
+
+	using ProgramReader = SnapshotPublisher<ConnectionProgram>::ScopedReader;
+
 	ModulationDisplayValue getDisplayValue(double nv, NormalisableRange<double> nr) const;
 
 	void setValueRange(bool isInputRange, scriptnode::InvertableParameterRange nr);
@@ -201,7 +220,6 @@ private:
 	bool rangeRecursiveChecker = false;
 	MatrixIds::Helpers::Properties::RangeData rangeData;
 
-	bool hasScaleEnvelopes = false;
 	uint8 active[NUM_POLYPHONIC_VOICES];
 
 	mutable SimpleReadWriteLock matrixLock;
@@ -217,9 +235,7 @@ private:
 	valuetree::PropertyListener outputRangeWatcher;
 
 	OwnedArray<Item> items;
-	std::vector<ModType*> scaleMods;
-	std::vector<ModType*> addMods;
-	std::vector<ModType*> allMods;
+	SnapshotPublisher<ConnectionProgram> program;
 
 	float inputValue = 0.0f;
 	sfloat baseValue;
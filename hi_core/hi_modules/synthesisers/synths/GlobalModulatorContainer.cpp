@@ -536,6 +536,29 @@ void GlobalModulatorContainer::preVoiceRendering(int startSample, int numThisTim
     }
 }
 
+void GlobalModulatorContainer::setVoiceLimit(int newVoiceLimit)
+{
+	auto oldLimit = getInternalVoiceLimit();
+
+	ModulatorSynth::setVoiceLimit(newVoiceLimit);
+
+	if (oldLimit == getInternalVoiceLimit() || envelopeData.isEmpty())
+		return;
+
+	auto f = [](Processor* p)
+	{
+		auto gc = static_cast<GlobalModulatorContainer*>(p);
+
+		for (auto& e : gc->envelopeData)
+			e.setNumVoices(gc->getInternalVoiceLimit());
+
+		return SafeFunctionCall::OK;
+	};
+
+	// The resizing allocates, so we need to kill the voices and do it outside the audio callback
+	getMainController()->getKillStateHandler().killVoicesAndCall(this, f, MainController::KillStateHandler::TargetThread::SampleLoadingThread);
+}
+
 void GlobalModulatorContainer::prepareToPlay(double newSampleRate, int samplesPerBlock)
 {
 	ModulatorSynth::prepareToPlay(newSampleRate, samplesPerBlock);
@@ -660,10 +683,10 @@ void GlobalModulatorContainer::refreshList()
 	envelopeData.clearQuick();
 
 	for (auto& mod : handler_->activeEnvelopesList)
-		envelopeData.add(EnvelopeData(mod, getLargestBlockSize()));
+		envelopeData.add(EnvelopeData(mod, getLargestBlockSize(), getInternalVoiceLimit()));
 
 	for(auto& mod: handler_->activeMonophonicEnvelopesList)
-		envelopeData.add(EnvelopeData(mod, getLargestBlockSize()));
+		envelopeData.add(EnvelopeData(mod, getLargestBlockSize(), getInternalVoiceLimit()));
 
 	runtimeSource.updateTargets();
 }
@@ -749,6 +772,18 @@ void GlobalModulatorContainerVoice::checkRelease()
 		resetVoice();
 }
 
+void GlobalModulatorContainerVoice::resetVoice()
+{
+	auto gc = static_cast<GlobalModulatorContainer*>(getOwnerSynth());
+
+	// If the voice was killed, the envelope state might still be playing, so
+	// we need to give back the buffer row before the event is cleared
+	for (auto& e : gc->envelopeData)
+		e.resetVoice(getCurrentHiseEvent());
+
+	ModulatorSynthVoice::resetVoice();
+}
+
 GlobalModulatorData::GlobalModulatorData(Processor *modulator_):
 modulator(modulator_),
 valuesForCurrentBuffer(1, 0)
@@ -59,6 +59,8 @@ public:
 
 	void checkRelease() override;
 
+	void resetVoice() override;
+
 };
 
 template <class ModulatorType> class GlobalModulatorDataBase: public scriptnode::modulation::Host
@@ -230,9 +232,16 @@ public:
 
 	using ClearState = scriptnode::modulation::ClearState;
 
-	EnvelopeData(Modulator* mod, int samplesPerBlock) :
+	/** Creates the envelope storage for the given modulator.
+	 *
+	 *  The sample buffer only contains a row for the mono signal and two rows per voice of the container
+	 *  (the second half is headroom so that a row is always available while a stolen voice is reset).
+	 *  The rows are assigned to the event IDs when the voice starts, so the memory grows with the voice
+	 *  amount of the container instead of NUM_POLYPHONIC_VOICES.
+	 */
+	EnvelopeData(Modulator* mod, int samplesPerBlock, int numVoices) :
 		GlobalModulatorDataBase(mod),
-		savedValuesForBlock(NUM_POLYPHONIC_VOICES, 0),
+		savedValuesForBlock(getNumRowsForVoices(numVoices), 0),
 	    emptyBlock(1, 0),
 		monophonicallyReducedSignal(1, 0)
 	{
@@ -240,8 +249,12 @@ public:
 		{
 			isClear[i] = ClearState::Reset;
 			thisBlockSize[i] = 0;
+			rowForIndex[i] = -1;
 		}
 
+		for(int i = 0; i < NUM_POLYPHONIC_VOICES + 1; i++)
+			indexForRow[i] = -1;
+
 		prepareToPlay(samplesPerBlock);
 	}
 
@@ -253,6 +266,29 @@ public:
 		monoBlockSize = monophonicallyReducedSignal.getNumSamples() / HISE_CONTROL_RATE_DOWNSAMPLING_FACTOR;
 	}
 
+	/** Resizes the buffer to the voice amount of the container. This allocates, so call it only while the voices are killed. */
+	void setNumVoices(int numVoices)
+	{
+		auto numRows = getNumRowsForVoices(numVoices);
+
+		if(numRows == savedValuesForBlock.getNumChannels())
+			return;
+
+		savedValuesForBlock.setSize(numRows, savedValuesForBlock.getNumSamples());
+
+		for(int i = 0; i < NUM_POLYPHONIC_VOICES; i++)
+		{
+			isClear[i] = ClearState::Reset;
+			thisBlockSize[i] = 0;
+			rowForIndex[i] = -1;
+		}
+
+		for(int i = 0; i < NUM_POLYPHONIC_VOICES + 1; i++)
+			indexForRow[i] = -1;
+
+		nextRow = 0;
+	}
+
 	bool isPlaying(const HiseEvent& voiceEvent) const
 	{
 		auto idx = getIndexForEvent(voiceEvent);
@@ -270,7 +306,12 @@ public:
 		if(voiceIndex == -1 || (isClear[voiceIndex] == ClearState::Reset))
 			return nullptr;
 
-		return savedValuesForBlock.getReadPointer(voiceIndex, startSample);
+		auto row = getRowForIndex(voiceIndex);
+
+		if(row == -1)
+			return nullptr;
+
+		return savedValuesForBlock.getReadPointer(row, startSample);
 	}
 
 	const float* getMonoReadBuffer() const
@@ -307,8 +348,13 @@ public:
 		if(voiceIndex == -1 || (isClear[voiceIndex] == ClearState::Reset))
 			return { nullptr, nullptr };
 
+		auto row = getRowForIndex(voiceIndex);
+
+		if(row == -1)
+			return { nullptr, nullptr };
 
-		return { thisBlockSize + voiceIndex, savedValuesForBlock.getReadPointer(voiceIndex, startSample) };
+		// the block size and reset flag stay indexed by the event ID because scriptnode reads them directly
+		return { thisBlockSize + voiceIndex, savedValuesForBlock.getReadPointer(row, startSample) };
 	}
 
 	static RuntimeData getModulationSignalStatic(Host* obj, const HiseEvent& e, bool wantsPolyphonicSignal)
@@ -345,10 +391,12 @@ public:
 
 		auto& flag = isClear[voiceIndex];
 
-		if(flag != ClearState::Reset)
+		auto row = getRowForIndex(voiceIndex);
+
+		if(flag != ClearState::Reset && row != -1)
 		{
 			thisBlockSize[voiceIndex] = startSample + numSamples;
-			auto dest = savedValuesForBlock.getWritePointer(voiceIndex, startSample);
+			auto dest = savedValuesForBlock.getWritePointer(row, startSample);
 			FloatVectorOperations::copy(dest, data + startSample, numSamples);
 
 			useMonoBufferAsSource = false;
@@ -376,9 +424,25 @@ public:
 
 		jassert(voiceIndex != -1);
 
+		if(!getModulator()->isInMonophonicMode())
+			allocateRow(voiceIndex);
+
 		isClear[voiceIndex] = ClearState::Playing;
 	}
 
+	/** Resets the state and releases the buffer row of a voice that was killed before it could run through the release. */
+	void resetVoice(const HiseEvent& voiceEvent)
+	{
+		auto voiceIndex = getIndexForEvent(voiceEvent);
+
+		if(voiceIndex != -1 && !getModulator()->isInMonophonicMode())
+		{
+			isClear[voiceIndex] = ClearState::Reset;
+			thisBlockSize[voiceIndex] = 0;
+			releaseRow(voiceIndex);
+		}
+	}
+
 	/** Check if clear was called and return true if it's still playing.
 	 *
 	 *  This will leave two buffers through to avoid cutting off the release trail.
@@ -398,6 +462,10 @@ public:
 			{
 				isClear[voiceIndex] = ClearState::Reset;
 				thisBlockSize[voiceIndex] = 0;
+
+				if(!getModulator()->isInMonophonicMode())
+					releaseRow(voiceIndex);
+
 				return false;
 			}
 			else if (isClear[voiceIndex] == ClearState::Reset)
@@ -413,7 +481,71 @@ public:
 
 private:
 
-	
+	/** Returns the buffer row for the given index. The mono signal always uses the first row. */
+	int getRowForIndex(int voiceIndex) const
+	{
+		if(getModulator()->isInMonophonicMode())
+			return 0;
+
+		return rowForIndex[voiceIndex];
+	}
+
+	int getNumPolyphonicRows() const { return savedValuesForBlock.getNumChannels() - 1; }
+
+	static int getNumRowsForVoices(int numVoices) { return 1 + jlimit(1, NUM_POLYPHONIC_VOICES, numVoices * 2); }
+
+	void allocateRow(int voiceIndex)
+	{
+		if(rowForIndex[voiceIndex] != -1)
+			return;
+
+		auto numRows = getNumPolyphonicRows();
+		int row = -1;
+
+		for(int i = 0; i < numRows; i++)
+		{
+			auto r = 1 + (nextRow + i) % numRows;
+			auto owner = indexForRow[r];
+
+			if(owner == -1 || isClear[owner] == ClearState::Reset)
+			{
+				row = r;
+				break;
+			}
+		}
+
+		if(row == -1)
+		{
+			// More envelopes than rows, this shouldn't happen because the container voices
+			// must be alive as long as the envelope is playing. Take over the oldest row.
+			jassertfalse;
+			row = 1 + nextRow % numRows;
+		}
+
+		auto previousOwner = indexForRow[row];
+
+		if(previousOwner != -1)
+		{
+			rowForIndex[previousOwner] = -1;
+			isClear[previousOwner] = ClearState::Reset;
+			thisBlockSize[previousOwner] = 0;
+		}
+
+		indexForRow[row] = voiceIndex;
+		rowForIndex[voiceIndex] = row;
+		nextRow = row % numRows;
+	}
+
+	void releaseRow(int voiceIndex)
+	{
+		auto row = rowForIndex[voiceIndex];
+
+		if(row != -1)
+		{
+			indexForRow[row] = -1;
+			rowForIndex[voiceIndex] = -1;
+		}
+	}
 
 	int getIndexForEvent(const HiseEvent& voiceEvent) const
 	{
@@ -436,6 +568,10 @@ private:
 	int thisBlockSize[NUM_POLYPHONIC_VOICES];
 
 	ClearState isClear[NUM_POLYPHONIC_VOICES];
+
+	int rowForIndex[NUM_POLYPHONIC_VOICES];
+	int indexForRow[NUM_POLYPHONIC_VOICES + 1];
+	int nextRow = 0;
 };
 
 class GlobalModulatorData
@@ -640,6 +776,9 @@ public:
 
 	void prepareToPlay(double sampleRate, int samplesPerBlock) override;
 
+	/** Resizes the envelope buffers to the new voice limit. */
+	void setVoiceLimit(int newVoiceLimit) override;
+
 	void addModulatorControlledParameter(const Processor* modulationSource, Processor* processor, int parameterIndex, NormalisableRange<double> range, int macroIndex);
 	void removeModulatorControlledParameter(const Processor* modulationSource, Processor* processor, int parameterIndex);
 	bool isModulatorControlledParameter(Processor* processor, int parameterIndex) const;
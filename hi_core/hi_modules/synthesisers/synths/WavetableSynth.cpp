@@ -1289,7 +1289,18 @@ void WavetableSynthVoice::calculateBlock(int startSample, int numSamples)
 	
 	WavetableSound::RenderData r(voiceBuffer, startSample, numSamples, uptimeDelta, voicePitchValues, hqMode);
 
-	r.render(currentSound, voiceUptime, [owner](int startSample) { return owner->getTotalTableModValue(startSample); });
+	if (startSample + numSamples <= maxNumSamples)
+	{
+		for (int i = startSample; i < startSample + numSamples; i++)
+			tableModValues[i] = owner->getTotalTableModValue(i);
+
+		r.render(currentSound, voiceUptime, tableModValues.get());
+	}
+	else
+	{
+		jassertfalse;
+		r.render(currentSound, voiceUptime, [owner](int startSample) { return owner->getTotalTableModValue(startSample); });
+	}
 
 	if (refreshMipmap)
 	{
@@ -1336,6 +1347,17 @@ void WavetableSynthVoice::calculateBlock(int startSample, int numSamples)
 	}
 }
 
+void WavetableSynthVoice::prepareToPlay(double sampleRate, int samplesPerBlock)
+{
+	ModulatorSynthVoice::prepareToPlay(sampleRate, samplesPerBlock);
+
+	if (samplesPerBlock > maxNumSamples)
+	{
+		maxNumSamples = samplesPerBlock;
+		tableModValues.calloc(maxNumSamples);
+	}
+}
+
 void WavetableSynthVoice::startNote(int midiNoteNumber, float /*velocity*/, SynthesiserSound* s, int /*currentPitchWheelPosition*/)
 {
     currentSound = nullptr;
@@ -1536,70 +1558,121 @@ String WavetableSound::getMarkdownDescription() const
 
 void WavetableSound::RenderData::render(WavetableSound* currentSound, double& voiceUptime, const TableIndexFunction& tf)
 {
-	auto numTables = currentSound->getWavetableAmount();
-	auto stereoMode = currentSound->isStereo();
-	auto tableSize = currentSound->getTableSize();
-
 	dynamicPhase = currentSound->dynamicPhase;
 
-	while (--numSamples >= 0)
+	// This might be called on the audio thread, so the values are evaluated into a stack buffer chunk by chunk
+	float tableModValues[ChunkSize];
+
+	while (numSamples > 0)
 	{
-		int index = (int)voiceUptime;
+		const int numThisTime = jmin(numSamples, ChunkSize);
 
-		span<int, 4> i;
+		for (int s = 0; s < numThisTime; s++)
+			tableModValues[s] = tf(startSample + s);
 
-#if USE_MOD2_WAVETABLESIZE
-		i[0] = (index + tableSize - 1) & (tableSize - 1);
-		i[1] = index & (tableSize - 1);
-		i[2] = (index + 1) & (tableSize - 1);
-		i[3] = (index + 2) & (tableSize - 1);
-#else
-		i[1] = index % (tableSize);
-		i[2] = i[1] + 1;
-		i[0] = i[1] - 1;
-		i[3] = i[1] + 2;
+		renderNextChunk(currentSound, voiceUptime, tableModValues);
+	}
+}
+
+void WavetableSound::RenderData::render(WavetableSound* currentSound, double& voiceUptime, const float* tableModValues)
+{
+	dynamicPhase = currentSound->dynamicPhase;
 
-		if (i[1] == 0)         i[0] = tableSize - 1;
-		if (i[2] >= tableSize) i[2] = 0;
-		if (i[3] >= tableSize) i[3] = 0;
+	while (numSamples > 0)
+		renderNextChunk(currentSound, voiceUptime, tableModValues + startSample);
+}
 
-#endif
+void WavetableSound::RenderData::renderNextChunk(WavetableSound* currentSound, double& voiceUptime, const float* chunkModValues)
+{
+	auto numTables = currentSound->getWavetableAmount();
 
-		const float tableModValue = tf(startSample);
-		const float tableValue = tableModValue * (float)(numTables - 1);
+	// The read positions and table indexes are calculated for a chunk first, so that the
+	// interpolation loop has no dependency between the samples and is shared by both channels.
+	int indexes[ChunkSize];
+	float alphas[ChunkSize];
+	int tableIndexes[ChunkSize];
+	float tableDeltas[ChunkSize];
 
+	const int numThisTime = jmin(numSamples, ChunkSize);
+	bool sameTable = true;
+
+	for (int s = 0; s < numThisTime; s++)
+	{
+		const int index = (int)voiceUptime;
+
+		indexes[s] = index;
+		alphas[s] = float(voiceUptime) - (float)index;
+
+		const float tableValue = chunkModValues[s] * (float)(numTables - 1);
 		const int lowerTableIndex = (int)(tableValue);
 
-		const float tableDelta = tableValue - (float)lowerTableIndex;
-		jassert(0.0f <= tableDelta && tableDelta <= 1.0f);
+		tableIndexes[s] = lowerTableIndex;
+		tableDeltas[s] = tableValue - (float)lowerTableIndex;
+		jassert(0.0f <= tableDeltas[s] && tableDeltas[s] <= 1.0f);
 
-		const int upperTableIndex = jmin(numTables - 1, lowerTableIndex + 1);
+		sameTable &= (lowerTableIndex == tableIndexes[0]);
 
-		auto lowerTable = currentSound->getWaveTableData(0, lowerTableIndex);
-		auto upperTable = currentSound->getWaveTableData(0, upperTableIndex);
-		const float alpha = float(voiceUptime) - (float)index;
+		jassert(voicePitchValues == nullptr || voicePitchValues[startSample + s] > 0.0f);
 
-		auto l = calculateSample(lowerTable, upperTable, i, alpha, tableDelta);
+		voiceUptime += (uptimeDelta * (voicePitchValues == nullptr ? 1.0 : voicePitchValues[startSample + s]));
+	}
 
-		// Stereo mode assumed
-		b.setSample(0, startSample, l);
+	renderChunk(currentSound, 0, indexes, alphas, tableIndexes, tableDeltas, numThisTime, sameTable);
 
-		if (stereoMode)
-		{
-			auto lowerTableR = currentSound->getWaveTableData(1, lowerTableIndex);
-			auto upperTableR = currentSound->getWaveTableData(1, upperTableIndex);
+	if (currentSound->isStereo())
+		renderChunk(currentSound, 1, indexes, alphas, tableIndexes, tableDeltas, numThisTime, sameTable);
 
-			auto r = calculateSample(lowerTableR, upperTableR, i, alpha, tableDelta);
-			b.setSample(1, startSample, r);
-		}
+	startSample += numThisTime;
+	numSamples -= numThisTime;
+}
 
-		jassert(voicePitchValues == nullptr || voicePitchValues[startSample] > 0.0f);
+span<int, 4> WavetableSound::RenderData::getWrappedIndexes(int index, int tableSize)
+{
+	span<int, 4> i;
 
-		const double delta = (uptimeDelta * (voicePitchValues == nullptr ? 1.0 : voicePitchValues[startSample]));
+#if USE_MOD2_WAVETABLESIZE
+	i[0] = (index + tableSize - 1) & (tableSize - 1);
+	i[1] = index & (tableSize - 1);
+	i[2] = (index + 1) & (tableSize - 1);
+	i[3] = (index + 2) & (tableSize - 1);
+#else
+	i[1] = index % (tableSize);
+	i[2] = i[1] + 1;
+	i[0] = i[1] - 1;
+	i[3] = i[1] + 2;
+
+	if (i[1] == 0)         i[0] = tableSize - 1;
+	if (i[2] >= tableSize) i[2] = 0;
+	if (i[3] >= tableSize) i[3] = 0;
+#endif
 
-		voiceUptime += delta;
+	return i;
+}
+
+void WavetableSound::RenderData::renderChunk(WavetableSound* currentSound, int channel, const int* indexes, const float* alphas, const int* tableIndexes, const float* tableDeltas, int numThisTime, bool sameTable)
+{
+	auto numTables = currentSound->getWavetableAmount();
+	auto tableSize = currentSound->getTableSize();
+	auto out = b.getWritePointer(channel, startSample);
+
+	if (sameTable)
+	{
+		// The table index modulation is (almost) static, so we can skip the table lookup for each sample
+		auto lowerTable = currentSound->getWaveTableData(channel, tableIndexes[0]);
+		auto upperTable = currentSound->getWaveTableData(channel, jmin(numTables - 1, tableIndexes[0] + 1));
 
-		++startSample;
+		for (int s = 0; s < numThisTime; s++)
+			out[s] = calculateSample(lowerTable, upperTable, getWrappedIndexes(indexes[s], tableSize), alphas[s], tableDeltas[s]);
+	}
+	else
+	{
+		for (int s = 0; s < numThisTime; s++)
+		{
+			auto lowerTable = currentSound->getWaveTableData(channel, tableIndexes[s]);
+			auto upperTable = currentSound->getWaveTableData(channel, jmin(numTables - 1, tableIndexes[s] + 1));
+
+			out[s] = calculateSample(lowerTable, upperTable, getWrappedIndexes(indexes[s], tableSize), alphas[s], tableDeltas[s]);
+		}
 	}
 }
 
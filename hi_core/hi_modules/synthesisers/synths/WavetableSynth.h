@@ -139,6 +139,9 @@ public:
 
 	struct RenderData
 	{
+		/** The number of samples that are processed in one step of the renderer. */
+		static constexpr int ChunkSize = 64;
+
 		using TableIndexFunction = std::function<float(int)>;
 		RenderData(AudioSampleBuffer& b_, int startSample_, int numSamples_, double uptimeDelta_, const float* voicePitchValues_, bool hqMode_) :
 			b(b_),
@@ -159,7 +162,22 @@ public:
 
 		void render(WavetableSound* currentSound, double& voiceUptime, const TableIndexFunction& tf);
 
+		/** Renders the block using the table index modulation values (0...1) from the given buffer.
+		
+			The buffer is indexed like the voice pitch values (so it starts at startSample). 
+		*/
+		void render(WavetableSound* currentSound, double& voiceUptime, const float* tableModValues);
+
 		float calculateSample(const float* lowerTable, const float* upperTable, const span<int, 4>& i, float alpha, float tableAlpha) const;
+
+	private:
+
+		/** Renders the next ChunkSize samples (or less) and advances startSample. The values start at the chunk. */
+		void renderNextChunk(WavetableSound* currentSound, double& voiceUptime, const float* chunkModValues);
+
+		static span<int, 4> getWrappedIndexes(int index, int tableSize);
+
+		void renderChunk(WavetableSound* currentSound, int channel, const int* indexes, const float* alphas, const int* tableIndexes, const float* tableDeltas, int numThisTime, bool sameTable);
 	};
 
 private:
@@ -212,6 +230,8 @@ public:
 
 	void calculateBlock(int startSample, int numSamples) override;;
 
+	void prepareToPlay(double sampleRate, int samplesPerBlock) override;
+
 	void setRefreshMipmap(bool refreshMipmap_)
 	{
 		refreshMipmap = refreshMipmap_;
@@ -241,6 +261,9 @@ private:
 	bool hqMode = true;
 	bool refreshMipmap = false;
 
+	HeapBlock<float> tableModValues;
+	int maxNumSamples = 0;
+
 	float const *currentTable;
 };
 
@@ -184,11 +184,158 @@ void SynthSoundWithBitmask::dump()
 	Helpers::dumpBitmask("sample", getBitmask(), 'S');
 }
 
+struct ComplexGroupManager::Prefetcher: public SampleThreadPool::Job
+{
+	enum class GroupState
+	{
+		Purged,
+		Loaded,
+		PendingEviction
+	};
+
+	struct Group
+	{
+		std::atomic<GroupState> state = { GroupState::Loaded };
+		std::atomic<uint32> lastUsed = { 0 };
+		int64 numBytes = -1;
+	};
+
+	struct LayerState
+	{
+		LayerState(uint8 layerIndex_, uint8 numItems_):
+		  layerIndex(layerIndex_),
+		  numItems(numItems_),
+		  groups((size_t)numItems_),
+		  transitions((size_t)numItems_ * (size_t)numItems_)
+		{}
+
+		/** Returns the counter how often the group switched from one value to the other (both one-based). */
+		std::atomic<uint32>& getTransitionCounter(uint8 from, uint8 to)
+		{
+			return transitions[(size_t)(from - 1) * numItems + (size_t)(to - 1)];
+		}
+
+		const uint8 layerIndex;
+		const uint8 numItems;
+		std::atomic<uint8> currentValue = { 0 };
+		std::vector<Group> groups;
+		std::vector<std::atomic<uint32>> transitions;
+	};
+
+	Prefetcher(ComplexGroupManager& parent_):
+	  Job("Group Prefetcher"),
+	  parent(parent_)
+	{}
+
+	~Prefetcher() override
+	{
+		signalJobShouldExit();
+
+		while(isRunning())
+			Thread::sleep(1);
+	}
+
+	/** Called from the audio thread whenever the filter of a purgable layer changes. */
+	void onFilterChange(uint8 layerIndex, uint8 value);
+
+	/** Rebuilds the layer states from the current purge state of the sounds. */
+	void rebuild();
+
+	/** Posts a request to the sample loading thread. This is safe to call from the audio thread. */
+	void triggerJob();
+
+	bool hasPendingRequest() const { return dirty.load(); }
+
+	SampleThreadPool* getThreadPool() const;
+
+	JobStatus runJob() override;
+
+	PrefetchStatistics getStatistics() const;
+
+	std::atomic<bool> enabled = { false };
+	std::atomic<int64> memoryBudget = { 0 };
+	std::atomic<int> numPredictions = { 2 };
+
+private:
+
+	template <typename F> void forEachSoundInGroup(const LayerState& ls, uint8 value, const F& f)
+	{
+		ValueWithFilter vf;
+		parent.layers[ls.layerIndex]->setValueFilter(vf, value);
+
+		// we don't want to include the ignored samples here
+		vf.ignoreMask = 0;
+
+		for(auto s: *parent.soundList)
+		{
+			if(auto typed = dynamic_cast<SampleType*>(s))
+			{
+				if(vf.matches(typed->getBitmask()))
+					f(*typed);
+			}
+		}
+	}
+
+	/** A group that is loaded or released without holding the prefetch lock. */
+	struct WorkItem
+	{
+		uint8 layerIndex = 0;
+		uint8 value = 0;
+		bool shouldLoad = false;
+		ReferenceCountedArray<SynthesiserSound> sounds;
+		int64 numBytes = 0;
+	};
+
+	LayerState* getLayerState(uint8 layerIndex) const;
+
+	int getPreloadSize() const;
+
+	/** Collects the bitmasks of all sounds that are currently played by a voice of the sampler. */
+	Array<SynthSoundWithBitmask::Bitmask> getPlayingBitmasks() const;
+
+	bool isGroupPlaying(const LayerState& ls, uint8 value, const Array<SynthSoundWithBitmask::Bitmask>& playingMasks) const;
+
+	/** Creates a work item with the sounds of the group. Call this with the prefetch lock held. */
+	WorkItem createWorkItem(const LayerState& ls, uint8 value, bool shouldLoad);
+
+	/** Loads or releases the sounds of the work items and updates the group states. Call this without the prefetch lock. 
+	 *
+	 *  Returns true if a group was loaded.
+	 */
+	bool processWorkItems(Array<WorkItem>& items);
+
+	Array<uint8> getPredictions(LayerState& ls, uint8 currentValue) const;
+
+	int64 getMemoryUsage(bool includePendingEvictions) const;
+
+	int64 getEstimatedMemory(const LayerState& ls, uint8 value) const;
+
+	bool evictGroups();
+
+	ComplexGroupManager& parent;
+
+	SimpleReadWriteLock stateLock;
+	OwnedArray<LayerState> layerStates;
+
+	std::atomic<bool> dirty = { false };
+	std::atomic<uint32> useCounter = { 0 };
+
+	std::atomic<int> numHits = { 0 };
+	std::atomic<int> numMisses = { 0 };
+	std::atomic<int> numLoads = { 0 };
+	std::atomic<int> numEvictions = { 0 };
+	std::atomic<int64> memoryUsage = { 0 };
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Prefetcher);
+};
+
 ComplexGroupManager::ComplexGroupManager(ReferenceCountedArray<SynthesiserSound>* allSounds, PooledUIUpdater* updater):
 	soundList(allSounds),
 	data(groupIds::Layers),
 	updater(*this) 
 {
+	prefetcher = new Prefetcher(*this);
+
 	dataListener.setCallback(data, valuetree::AsyncMode::Synchronously, BIND_MEMBER_FUNCTION_2(ComplexGroupManager::onDataChange));
 
 	groupRebuildListener.setCallback(data, 
@@ -200,6 +347,7 @@ ComplexGroupManager::ComplexGroupManager(ReferenceCountedArray<SynthesiserSound>
 
 ComplexGroupManager::~ComplexGroupManager()
 {
+	prefetcher = nullptr;
 	layers.clear();
 	soundList = nullptr;
 
@@ -2116,6 +2264,9 @@ void ComplexGroupManager::applyFilter(uint8 layerIndex, uint8 value, Notificatio
 		if(Helpers::shouldBeCached(l.propertyFlags))
 			l.mask(currentGroupFilter, value, false);
 
+		if(Helpers::canBePurged(l.propertyFlags))
+			prefetcher->onFilterChange(layerIndex, value);
+
 		l.playStateBroadcaster.sendMessage(n, value);
 	}
 }
@@ -2794,6 +2945,8 @@ float ComplexGroupManager::getGroupVolume(uint8 layerIndex, uint8 value) const
 
 void ComplexGroupManager::rebuildGroups()
 {
+	ScopedLock sl(prefetchLock);
+
 	groups.clear();
 
 	std::vector<std::vector<ValueWithFilter>> allMasks;
@@ -2853,8 +3006,24 @@ void ComplexGroupManager::refreshCache()
 {
 	jassert(soundList != nullptr);
 
+	ScopedLock sl(prefetchLock);
+
 	currentFilters.clear();
 
+	rebuildNoteContainers();
+
+	activeDelayLayers.clear();
+
+	for(auto l: layers)
+		l->onCacheRebuild(*this);
+
+	prefetcher->rebuild();
+
+	resetPlayingState();
+}
+
+void ComplexGroupManager::rebuildNoteContainers()
+{
 	if(groups.size() == 1)
 	{
 		groups[0]->rebuild(*soundList);
@@ -2878,13 +3047,535 @@ void ComplexGroupManager::refreshCache()
 			g->rebuild(tempList);
 		}
 	}
+}
 
-	activeDelayLayers.clear();
+void ComplexGroupManager::setPrefetchOptions(const PrefetchOptions& newOptions)
+{
+	prefetcher->memoryBudget.store(jmax<int64>(0, newOptions.memoryBudget));
+	prefetcher->numPredictions.store(jlimit(0, 255, newOptions.numPredictions));
+	prefetcher->enabled.store(newOptions.enabled);
 
-	for(auto l: layers)
-		l->onCacheRebuild(*this);
+	// apply the memory budget to the current state
+	if(newOptions.enabled)
+		prefetcher->triggerJob();
+}
 
-	resetPlayingState();
+void ComplexGroupManager::processPendingPrefetchRequest()
+{
+	// the sample loading thread will take care of it
+	if(prefetcher->getThreadPool() != nullptr)
+		return;
+
+	if(prefetcher->hasPendingRequest())
+		prefetcher->runJob();
+}
+
+ComplexGroupManager::PrefetchOptions ComplexGroupManager::getPrefetchOptions() const
+{
+	PrefetchOptions o;
+	o.enabled = prefetcher->enabled.load();
+	o.memoryBudget = prefetcher->memoryBudget.load();
+	o.numPredictions = prefetcher->numPredictions.load();
+	return o;
+}
+
+ComplexGroupManager::PrefetchStatistics ComplexGroupManager::getPrefetchStatistics() const
+{
+	return prefetcher->getStatistics();
+}
+
+void ComplexGroupManager::Prefetcher::onFilterChange(uint8 layerIndex, uint8 value)
+{
+	if(!enabled.load() || value == IgnoreFlag)
+		return;
+
+	{
+		// the layer states are being rebuilt, so we'll skip this one
+		SimpleReadWriteLock::ScopedTryReadLock sl(stateLock);
+
+		if(!sl)
+			return;
+
+		auto ls = getLayerState(layerIndex);
+
+		if(ls == nullptr || value == 0 || value > ls->numItems)
+			return;
+
+		auto prevValue = ls->currentValue.exchange(value);
+
+		if(prevValue == value)
+			return;
+
+		if(prevValue != 0)
+			ls->getTransitionCounter(prevValue, value)++;
+
+		auto& g = ls->groups[value - 1];
+
+		g.lastUsed.store(++useCounter);
+
+		if(g.state.load() == GroupState::Loaded)
+			++numHits;
+		else
+			++numMisses;
+	}
+
+	triggerJob();
+}
+
+void ComplexGroupManager::Prefetcher::rebuild()
+{
+	OwnedArray<LayerState> newStates;
+
+	for(auto l: parent.layers)
+	{
+		if(!Helpers::canBePurged(l->propertyFlags) || l->numItems == 0)
+			continue;
+
+		auto ls = newStates.add(new LayerState(l->layerIndex, l->numItems));
+		std::vector<bool> pendingEvictions((size_t)ls->numItems, false);
+
+		// keep the recorded history if the layer hasn't changed
+		if(auto prev = getLayerState(l->layerIndex))
+		{
+			if(prev->numItems == ls->numItems)
+			{
+				for(size_t i = 0; i < ls->groups.size(); i++)
+					pendingEvictions[i] = prev->groups[i].state.load() == GroupState::PendingEviction;
+
+				ls->currentValue.store(prev->currentValue.load());
+
+				for(size_t i = 0; i < ls->transitions.size(); i++)
+					ls->transitions[i].store(prev->transitions[i].load());
+
+				for(size_t i = 0; i < ls->groups.size(); i++)
+				{
+					ls->groups[i].lastUsed.store(prev->groups[i].lastUsed.load());
+					ls->groups[i].numBytes = prev->groups[i].numBytes;
+				}
+			}
+		}
+
+		for(uint8 v = 1; v <= ls->numItems; v++)
+		{
+			bool purged = false;
+			int64 numBytes = 0;
+
+			forEachSoundInGroup(*ls, v, [&](SampleType& s)
+			{
+				purged |= s.isPurged();
+				numBytes += s.getPreloadMemoryUsage();
+			});
+
+			auto& g = ls->groups[v - 1];
+
+			// the memory of the evicted groups is not released yet
+			if(purged && pendingEvictions[v - 1])
+				g.state.store(GroupState::PendingEviction);
+			else
+				g.state.store(purged ? GroupState::Purged : GroupState::Loaded);
+
+			if(!purged)
+				g.numBytes = numBytes;
+		}
+	}
+
+	SimpleReadWriteLock::ScopedMultiWriteLock sl(stateLock);
+	layerStates.swapWith(newStates);
+}
+
+hise::SampleThreadPool::Job::JobStatus ComplexGroupManager::Prefetcher::runJob()
+{
+	dirty.store(false);
+
+	if(!enabled.load())
+		return jobHasFinished;
+
+	auto playingMasks = getPlayingBitmasks();
+
+	Array<WorkItem> work;
+
+	{
+		ScopedLock sl(parent.prefetchLock);
+
+		// Release the memory of the groups that were evicted during the last run. They were
+		// removed from the note containers, so we only need to wait for the voices to stop.
+		for(auto ls: layerStates)
+		{
+			for(uint8 v = 1; v <= ls->numItems; v++)
+			{
+				if(ls->groups[v - 1].state.load() == GroupState::PendingEviction && !isGroupPlaying(*ls, v, playingMasks))
+					work.add(createWorkItem(*ls, v, false));
+			}
+		}
+
+		// This is a miss, so we'll make it playable before loading the predictions
+		for(auto ls: layerStates)
+		{
+			auto currentValue = ls->currentValue.load();
+
+			if(currentValue != 0 && ls->groups[currentValue - 1].state.load() != GroupState::Loaded)
+				work.add(createWorkItem(*ls, currentValue, true));
+		}
+	}
+
+	if(processWorkItems(work))
+	{
+		ScopedLock sl(parent.prefetchLock);
+		parent.rebuildNoteContainers();
+	}
+
+	work.clearQuick();
+
+	{
+		ScopedLock sl(parent.prefetchLock);
+
+		auto budget = memoryBudget.load();
+		auto plannedMemory = getMemoryUsage(false);
+
+		for(auto ls: layerStates)
+		{
+			auto currentValue = ls->currentValue.load();
+
+			if(currentValue == 0)
+				continue;
+
+			for(auto v: getPredictions(*ls, currentValue))
+			{
+				if(ls->groups[v - 1].state.load() == GroupState::Loaded)
+					continue;
+
+				auto estimatedMemory = getEstimatedMemory(*ls, v);
+
+				if(budget == 0 || plannedMemory + estimatedMemory <= budget)
+				{
+					work.add(createWorkItem(*ls, v, true));
+					plannedMemory += estimatedMemory;
+				}
+			}
+		}
+	}
+
+	auto containersChanged = processWorkItems(work);
+
+	if(shouldExit())
+		return jobHasFinished;
+
+	{
+		ScopedLock sl(parent.prefetchLock);
+
+		containersChanged |= evictGroups();
+
+		if(containersChanged)
+			parent.rebuildNoteContainers();
+
+		memoryUsage.store(getMemoryUsage(true));
+	}
+
+	if(auto s = parent.sampler.get())
+		s->refreshMemoryUsage(true);
+
+	return dirty.load() ? jobNeedsRunningAgain : jobHasFinished;
+}
+
+ComplexGroupManager::PrefetchStatistics ComplexGroupManager::Prefetcher::getStatistics() const
+{
+	PrefetchStatistics s;
+	s.numHits = numHits.load();
+	s.numMisses = numMisses.load();
+	s.numLoads = numLoads.load();
+	s.numEvictions = numEvictions.load();
+	s.memoryUsage = memoryUsage.load();
+	return s;
+}
+
+ComplexGroupManager::Prefetcher::LayerState* ComplexGroupManager::Prefetcher::getLayerState(uint8 layerIndex) const
+{
+	for(auto ls: layerStates)
+	{
+		if(ls->layerIndex == layerIndex)
+			return ls;
+	}
+
+	return nullptr;
+}
+
+void ComplexGroupManager::Prefetcher::triggerJob()
+{
+	dirty.store(true);
+
+	// If there is no sample loading thread, the request will be picked up
+	// by the next call to ComplexGroupManager::processPendingPrefetchRequest()
+	if(auto pool = getThreadPool())
+	{
+		if(!isQueued())
+			pool->addJob(this, false);
+	}
+}
+
+hise::SampleThreadPool* ComplexGroupManager::Prefetcher::getThreadPool() const
+{
+	if(auto s = parent.sampler.get())
+		return s->getMainController()->getSampleManager().getGlobalSampleThreadPool();
+
+	return nullptr;
+}
+
+int ComplexGroupManager::Prefetcher::getPreloadSize() const
+{
+	if(auto s = parent.sampler.get())
+	{
+		auto preloadSize = (int)s->getAttribute(ModulatorSampler::Parameters::PreloadSize);
+
+		if(preloadSize != -1)
+			preloadSize *= s->getPreloadScaleFactor();
+
+		return preloadSize;
+	}
+
+	return 0;
+}
+
+Array<SynthSoundWithBitmask::Bitmask> ComplexGroupManager::Prefetcher::getPlayingBitmasks() const
+{
+	Array<SynthSoundWithBitmask::Bitmask> masks;
+
+	if(auto s = parent.sampler.get())
+	{
+		for(int i = 0; i < s->getNumVoices(); i++)
+		{
+			auto v = static_cast<ModulatorSamplerVoice*>(s->getVoice(i));
+
+			// The sounds are only deleted on this thread, so it's safe to use the pointer
+			if(auto sound = v->getActiveSamplerSound())
+				masks.add(sound->getBitmask());
+		}
+	}
+
+	return masks;
+}
+
+bool ComplexGroupManager::Prefetcher::isGroupPlaying(const LayerState& ls, uint8 value, const Array<SynthSoundWithBitmask::Bitmask>& playingMasks) const
+{
+	auto& l = *parent.layers[ls.layerIndex];
+
+	for(auto m: playingMasks)
+	{
+		if(l.getUnmaskedValue(m) == value)
+			return true;
+	}
+
+	return false;
+}
+
+ComplexGroupManager::Prefetcher::WorkItem ComplexGroupManager::Prefetcher::createWorkItem(const LayerState& ls, uint8 value, bool shouldLoad)
+{
+	WorkItem item;
+	item.layerIndex = ls.layerIndex;
+	item.value = value;
+	item.shouldLoad = shouldLoad;
+
+	ValueWithFilter vf;
+	parent.layers[ls.layerIndex]->setValueFilter(vf, value);
+
+	// we don't want to include the ignored samples here
+	vf.ignoreMask = 0;
+
+	for(auto s: *parent.soundList)
+	{
+		if(auto typed = dynamic_cast<SampleType*>(s))
+		{
+			if(vf.matches(typed->getBitmask()))
+				item.sounds.add(s);
+		}
+	}
+
+	return item;
+}
+
+bool ComplexGroupManager::Prefetcher::processWorkItems(Array<WorkItem>& items)
+{
+	auto preloadSize = getPreloadSize();
+
+	for(auto& item: items)
+	{
+		for(auto s: item.sounds)
+		{
+			if(shouldExit())
+				return false;
+
+			auto typed = dynamic_cast<SampleType*>(s);
+
+			typed->setPurgedAndRefreshPreload(!item.shouldLoad, item.shouldLoad ? preloadSize : 0);
+
+			if(item.shouldLoad)
+				item.numBytes += typed->getPreloadMemoryUsage();
+		}
+	}
+
+	bool somethingLoaded = false;
+
+	ScopedLock sl(parent.prefetchLock);
+
+	// The layer states might have been rebuilt in the meantime
+	for(const auto& item: items)
+	{
+		auto ls = getLayerState(item.layerIndex);
+
+		if(ls == nullptr || item.value > ls->numItems)
+			continue;
+
+		auto& g = ls->groups[item.value - 1];
+
+		if(item.shouldLoad)
+		{
+			g.numBytes = item.numBytes;
+			g.state.store(GroupState::Loaded);
+			++numLoads;
+			somethingLoaded = true;
+		}
+		else
+		{
+			g.state.store(GroupState::Purged);
+		}
+	}
+
+	return somethingLoaded;
+}
+
+Array<uint8> ComplexGroupManager::Prefetcher::getPredictions(LayerState& ls, uint8 currentValue) const
+{
+	Array<std::pair<uint32, uint8>> candidates;
+
+	for(uint8 v = 1; v <= ls.numItems; v++)
+	{
+		if(v == currentValue)
+			continue;
+
+		if(auto numTransitions = ls.getTransitionCounter(currentValue, v).load())
+			candidates.add({ numTransitions, v });
+	}
+
+	struct Sorter
+	{
+		static int compareElements(const std::pair<uint32, uint8>& first, const std::pair<uint32, uint8>& second)
+		{
+			if(first.first > second.first)
+				return -1;
+			if(first.first < second.first)
+				return 1;
+
+			return 0;
+		}
+	} sorter;
+
+	candidates.sort(sorter, true);
+
+	Array<uint8> predictions;
+
+	for(const auto& c: candidates)
+	{
+		if(predictions.size() >= numPredictions.load())
+			break;
+
+		predictions.add(c.second);
+	}
+
+	return predictions;
+}
+
+int64 ComplexGroupManager::Prefetcher::getMemoryUsage(bool includePendingEvictions) const
+{
+	int64 numBytes = 0;
+
+	for(auto ls: layerStates)
+	{
+		for(const auto& g: ls->groups)
+		{
+			auto state = g.state.load();
+
+			if(state == GroupState::Loaded || (includePendingEvictions && state == GroupState::PendingEviction))
+				numBytes += jmax<int64>(0, g.numBytes);
+		}
+	}
+
+	return numBytes;
+}
+
+int64 ComplexGroupManager::Prefetcher::getEstimatedMemory(const LayerState& ls, uint8 value) const
+{
+	auto numBytes = ls.groups[value - 1].numBytes;
+
+	if(numBytes >= 0)
+		return numBytes;
+
+	// use the average of the other groups if this group was never loaded
+	int64 sum = 0;
+	int numKnown = 0;
+
+	for(const auto& g: ls.groups)
+	{
+		if(g.numBytes >= 0)
+		{
+			sum += g.numBytes;
+			numKnown++;
+		}
+	}
+
+	return numKnown > 0 ? sum / numKnown : 0;
+}
+
+bool ComplexGroupManager::Prefetcher::evictGroups()
+{
+	auto budget = memoryBudget.load();
+
+	if(budget == 0)
+		return false;
+
+	bool somethingEvicted = false;
+
+	while(getMemoryUsage(false) > budget)
+	{
+		LayerState* lruLayer = nullptr;
+		uint8 lruValue = 0;
+		uint32 lruTime = std::numeric_limits<uint32>::max();
+
+		for(auto ls: layerStates)
+		{
+			auto currentValue = ls->currentValue.load();
+
+			for(uint8 v = 1; v <= ls->numItems; v++)
+			{
+				const auto& g = ls->groups[v - 1];
+
+				if(v == currentValue || g.state.load() != GroupState::Loaded)
+					continue;
+
+				if(g.lastUsed.load() < lruTime)
+				{
+					lruLayer = ls;
+					lruValue = v;
+					lruTime = g.lastUsed.load();
+				}
+			}
+		}
+
+		// only the current groups are left
+		if(lruLayer == nullptr)
+			break;
+
+		// Remove it from the note containers first, the memory will be released
+		// in the next run when there are no voices playing this group anymore
+		forEachSoundInGroup(*lruLayer, lruValue, [](SampleType& s)
+		{
+			s.setPurged(true);
+		});
+
+		lruLayer->groups[lruValue - 1].state.store(GroupState::PendingEviction);
+		++numEvictions;
+		somethingEvicted = true;
+	}
+
+	return somethingEvicted;
 }
 
 ComplexGroupManager::ScopedMigrator::ScopedMigrator(ComplexGroupManager& gm_, SampleType* s_) :
@@ -217,6 +217,20 @@ struct SynthSoundWithBitmask: public ModulatorSynthSound
 		purged = shouldBePurged;
 	}
 
+	/** Changes the purge state and loads or releases the preload data of the sound.
+	 *
+	 *  This is called by the prefetcher of the ComplexGroupManager on the sample loading thread.
+	 *  Override this if your sound has preload buffers that should be loaded in the background.
+	 */
+	virtual void setPurgedAndRefreshPreload(bool shouldBePurged, int preloadSize)
+	{
+		ignoreUnused(preloadSize);
+		setPurged(shouldBePurged);
+	}
+
+	/** Override this and return the amount of bytes that the preload data of the sound uses. */
+	virtual int64 getPreloadMemoryUsage() const { return 0; }
+
 private:
 
 	Bitmask mask = 0;
@@ -470,6 +484,47 @@ struct ComplexGroupManager: public ModulatorSynth::SoundCollectorBase,
 	/** Call this whenever the sample amount changes. */
 	void refreshCache();
 
+	/** The settings for the predictive prefetching of purgable layers. */
+	struct PrefetchOptions
+	{
+		/** Enables the prefetcher. This will take over the purge state of every group in a purgable layer. */
+		bool enabled = false;
+
+		/** The maximum preload memory in bytes of all groups in purgable layers (zero means no limit). */
+		int64 memoryBudget = 0;
+
+		/** The amount of groups that are loaded in advance, sorted by how often they followed the current group. */
+		int numPredictions = 2;
+	};
+
+	struct PrefetchStatistics
+	{
+		int numHits = 0;		// the amount of group changes to a group that was already loaded
+		int numMisses = 0;		// the amount of group changes to a purged group
+		int numLoads = 0;		// the amount of groups that were loaded by the prefetcher
+		int numEvictions = 0;	// the amount of groups that were purged to stay within the memory budget
+		int64 memoryUsage = 0;	// the preload memory of all loaded groups in purgable layers
+	};
+
+	/** Enables the predictive prefetching of purgable layers.
+	 *
+	 *	If enabled, every change of the group filter in a purgable layer (eg. a keyswitch) will be recorded
+	 *	and the groups that are most likely to be used next will be unpurged on the sample loading thread.
+	 *	If the memory budget is exceeded, the least recently used groups will be purged again.
+	 */
+	void setPrefetchOptions(const PrefetchOptions& newOptions);
+
+	PrefetchOptions getPrefetchOptions() const;
+
+	/** Returns the hit / miss counters of the prefetcher. */
+	PrefetchStatistics getPrefetchStatistics() const;
+
+	/** Runs the pending prefetch request on the calling thread if there is no sample loading thread (eg. in the unit tests). 
+	 *
+	 *	Never call this from the audio thread.
+	 */
+	void processPendingPrefetchRequest();
+
 	template <typename T, typename F> void addPlaystateListener(T& obj, uint8 layerIndex, const F& f)
 	{
 		if(isPositiveAndBelow(layerIndex, layers.size()))
@@ -659,6 +714,15 @@ private:
 
 	bool matchesCurrentFilter(const HiseEvent& m, SampleType* typed) const;
 
+	struct Prefetcher;
+
+	/** Rebuilds the note containers without resetting the current filter state. */
+	void rebuildNoteContainers();
+
+	// Keeps the prefetcher from rebuilding the note containers while the groups change
+	CriticalSection prefetchLock;
+	ScopedPointer<Prefetcher> prefetcher;
+
 	void onDataChange(const ValueTree& c, bool wasAdded);
 
 	void onRebuildPropertyChange(const ValueTree& t, const Identifier& id);
@@ -75,8 +75,22 @@ struct ComplexGroupManagerTests: public UnitTest
 				return { l, h + 1 };
 			}
 
+			void setPurgedAndRefreshPreload(bool shouldBePurged, int) override
+			{
+				setPurged(shouldBePurged);
+				loaded = !shouldBePurged;
+			}
+
+			int64 getPreloadMemoryUsage() const override
+			{
+				return loaded ? PreloadMemory : 0;
+			}
+
+			static constexpr int64 PreloadMemory = 1000;
+
 			String sampleName;
 			BigInteger noteMap;
+			bool loaded = true;
 
 			JUCE_DECLARE_WEAK_REFERENCEABLE(TestDummy);
 		};
@@ -211,6 +225,7 @@ struct ComplexGroupManagerTests: public UnitTest
 			try
 			{
 				gm->applyFilter(id, tokenValue, dontSendNotification);
+				gm->processPendingPrefetchRequest();
 			}
 			catch(Result& r)
 			{
@@ -219,6 +234,38 @@ struct ComplexGroupManagerTests: public UnitTest
 			}
 		}
 
+		void setPrefetchOptions(int64 memoryBudget, int numPredictions)
+		{
+			ComplexGroupManager::PrefetchOptions o;
+			o.enabled = true;
+			o.memoryBudget = memoryBudget;
+			o.numPredictions = numPredictions;
+			gm->setPrefetchOptions(o);
+			gm->processPendingPrefetchRequest();
+		}
+
+		ComplexGroupManager::PrefetchStatistics getPrefetchStatistics() const
+		{
+			return gm->getPrefetchStatistics();
+		}
+
+		void expectPurged(const String& sampleName, bool shouldBePurged, bool shouldBeLoaded)
+		{
+			for(auto s: soundList)
+			{
+				auto typed = dynamic_cast<TestDummy*>(s);
+
+				if(typed->sampleName == sampleName)
+				{
+					parent->expectEquals(typed->isPurged(), shouldBePurged, sampleName + ": wrong purge state");
+					parent->expectEquals(typed->loaded, shouldBeLoaded, sampleName + ": wrong preload state");
+					return;
+				}
+			}
+
+			parent->expect(false, "Can't find sample " + sampleName);
+		}
+
 		int getNumSamplesWithFilter(const Identifier& groupId, uint8 tokenValue)
 		{
 			auto idx = gm->getLayerIndex(groupId);
@@ -327,6 +374,7 @@ struct ComplexGroupManagerTests: public UnitTest
 		testBigPatch();
 
 		testPurge();
+		testPrefetch();
 	}
 
 	void testFirst()
@@ -770,6 +818,65 @@ struct ComplexGroupManagerTests: public UnitTest
 		test.expectNumSamplesAtNoteOn("C2", 4);
 	}
 
+	void testPrefetch()
+	{
+		TestInstance test(this, "Testing the prefetching of purged keyswitches");
+
+		{
+			TestInstance::LayoutGenerator l(test);
+			l.addKeyswitchLayer({ "a", "b", "c" });
+		}
+
+		{
+			TestInstance::SampleMapGenerator s(test);
+			s.addSample("C2_a");
+			s.addSample("C2_b");
+			s.addSample("C2_c");
+		}
+
+		test.setPurged("Keyswitch", "b", true);
+		test.setPurged("Keyswitch", "c", true);
+
+		// the dummy sounds don't release their memory when purged manually
+		test.setPrefetchOptions(2 * TestInstance::TestDummy::PreloadMemory, 1);
+
+		test.setFilter("Keyswitch", "b");
+		test.expectNumSamplesAtNoteOn("C2", 1, "purged keyswitch wasn't loaded");
+		test.expectPurged("C2_b", false, true);
+
+		test.setFilter("Keyswitch", "a");
+		test.setFilter("Keyswitch", "b");
+
+		auto stats = test.getPrefetchStatistics();
+		expectEquals(stats.numHits, 2, "hits");
+		expectEquals(stats.numMisses, 1, "misses");
+		expectEquals(stats.numLoads, 1, "loads");
+		expectEquals(stats.numEvictions, 0, "evictions");
+
+		// this exceeds the budget so a must be evicted as the least recently used group
+		test.setFilter("Keyswitch", "c");
+		test.expectPurged("C2_a", true, true);
+		test.expectPurged("C2_c", false, true);
+
+		// a is a miss now, the memory of a is released before it's loaded again
+		// and b will be evicted
+		test.setFilter("Keyswitch", "a");
+		test.expectPurged("C2_a", false, true);
+		test.expectPurged("C2_b", true, true);
+		test.expectNumSamplesAtNoteOn("C2", 1, "evicted keyswitch wasn't loaded");
+
+		stats = test.getPrefetchStatistics();
+		expectEquals(stats.numHits, 2, "hits");
+		expectEquals(stats.numMisses, 3, "misses");
+		expectEquals(stats.numLoads, 3, "loads");
+		expectEquals(stats.numEvictions, 2, "evictions");
+
+		// the next run releases the memory of b (there are no voices in this test)
+		test.setFilter("Keyswitch", "c");
+		test.expectPurged("C2_b", true, false);
+		expectEquals(test.getPrefetchStatistics().memoryUsage, 2 * TestInstance::TestDummy::PreloadMemory, "memory usage");
+	}
+
 	
 };
 
@@ -516,6 +516,12 @@ void SampleMap::valueTreePropertyChanged(ValueTree& treeWhosePropertyHasChanged,
 	if (treeWhosePropertyHasChanged == data)
 		return;
 
+	if (transactionThread.load() == Thread::getCurrentThreadId())
+	{
+		currentTransaction->propertyWasChanged(treeWhosePropertyHasChanged, property);
+		return;
+	}
+
 	auto i = data.indexOf(treeWhosePropertyHasChanged);
 
 	if (i != -1)
@@ -2135,4 +2141,232 @@ void SampleMap::Notifier::Collector::handleAsyncUpdate()
 	parent.handleHeavyweightPropertyChanges();
 }
 
+void SampleMap::Listener::samplePropertiesWereChanged(const Array<PropertyColumn>& changes)
+{
+	for (const auto& c : changes)
+	{
+		for (int i = 0; i < c.sounds.size(); i++)
+		{
+			if (auto s = dynamic_cast<ModulatorSamplerSound*>(c.sounds[i].get()))
+				samplePropertyWasChanged(s, c.id, c.values[i]);
+		}
+	}
+}
+
+SampleMap::PropertyTransaction::PropertyTransaction(SampleMap& parent_) :
+	parent(parent_)
+{}
+
+void SampleMap::PropertyTransaction::set(ModulatorSamplerSound* sound, const Identifier& id, const var& newValue)
+{
+	if (sound == nullptr)
+		return;
+
+	auto& c = getColumn(pendingChanges, id);
+	c.sounds.add(sound);
+	c.values.add(newValue);
+}
+
+int SampleMap::PropertyTransaction::getNumChanges() const
+{
+	int numChanges = 0;
+
+	for (const auto& c : pendingChanges)
+		numChanges += c.sounds.size();
+
+	return numChanges;
+}
+
+SampleMap::PropertyColumn& SampleMap::PropertyTransaction::getColumn(Array<PropertyColumn>& list, const Identifier& id)
+{
+	for (auto& c : list)
+	{
+		if (c.id == id)
+			return c;
+	}
+
+	PropertyColumn newColumn;
+	newColumn.id = id;
+	list.add(newColumn);
+	return list.getReference(list.size() - 1);
+}
+
+void SampleMap::PropertyTransaction::propertyWasChanged(ValueTree& v, const Identifier& id)
+{
+	auto s = currentSound;
+
+	// The property of another sound was changed by a listener, so we need to look it up
+	if (s == nullptr || s->getData() != v)
+		s = parent.getSound(parent.data.indexOf(v));
+
+	if (s != nullptr)
+	{
+		auto& c = getColumn(appliedChanges, id);
+		c.sounds.add(s);
+		c.values.add(v.getProperty(id));
+	}
+}
+
+void SampleMap::PropertyTransaction::apply(bool useUndo)
+{
+	if (pendingChanges.isEmpty())
+		return;
+
+	auto sampler = parent.getSampler();
+
+	if (useUndo)
+		sampler->getUndoManager()->beginNewTransaction("Change sample properties");
+
+	{
+		// Collect the changes (including the clipped range properties) instead of sending update messages
+		jassert(parent.transactionThread.load() == nullptr);
+		ScopedValueSetter<PropertyTransaction*> svs(parent.currentTransaction, this);
+		parent.transactionThread.store(Thread::getCurrentThreadId());
+
+		for (const auto& c : pendingChanges)
+		{
+			for (int i = 0; i < c.sounds.size(); i++)
+			{
+				auto s = static_cast<ModulatorSamplerSound*>(c.sounds[i].get());
+
+				if (s->isDeletePending())
+					continue;
+
+				currentSound = s;
+				s->setSampleProperty(c.id, c.values[i], useUndo);
+			}
+		}
+
+		currentSound = nullptr;
+		parent.transactionThread.store(nullptr);
+	}
+
+	pendingChanges.clear();
+
+	Array<PropertyColumn> changes;
+	changes.swapWith(appliedChanges);
+
+	if (changes.isEmpty())
+		return;
+
+	bool hasAsyncChanges = false;
+
+	// The other properties only update a few members of the sound, so we can do this right away
+	for (const auto& c : changes)
+	{
+		if (ModulatorSamplerSound::isAsyncProperty(c.id))
+		{
+			hasAsyncChanges = true;
+			continue;
+		}
+
+		for (int i = 0; i < c.sounds.size(); i++)
+			static_cast<ModulatorSamplerSound*>(c.sounds[i].get())->updateInternalData(c.id, c.values[i]);
+	}
+
+	WeakReference<SampleMap> safeMap(&parent);
+
+	auto sendNotification = [safeMap, changes]()
+	{
+		if (safeMap.get() == nullptr)
+			return;
+
+		ScopedLock sl(safeMap->listeners.getLock());
+
+		for (auto l : safeMap->listeners)
+		{
+			if (l != nullptr)
+				l->samplePropertiesWereChanged(changes);
+		}
+	};
+
+	if (hasAsyncChanges)
+	{
+		auto f = [changes, sendNotification](Processor* p)
+		{
+			LockHelpers::SafeLock sl(p->getMainController(), LockHelpers::Type::SampleLock);
+
+			applyAsyncChanges(changes);
+			MessageManager::callAsync(sendNotification);
+
+			return SafeFunctionCall::OK;
+		};
+
+		sampler->killAllVoicesAndCall(f);
+	}
+	else
+	{
+		MessageManager::callAsync(sendNotification);
+	}
+}
+
+void SampleMap::PropertyTransaction::applyAsyncChanges(const Array<PropertyColumn>& changes)
+{
+	Array<ModulatorSamplerSound*> affectedSounds;
+
+	for (const auto& c : changes)
+	{
+		if (ModulatorSamplerSound::isAsyncProperty(c.id) && c.id != SampleIds::SampleState)
+		{
+			for (auto s : c.sounds)
+			{
+				auto ms = static_cast<ModulatorSamplerSound*>(s.get());
+
+				if (!ms->isDeletePending())
+					affectedSounds.add(ms);
+			}
+		}
+	}
+
+	std::sort(affectedSounds.begin(), affectedSounds.end());
+	auto end = std::unique(affectedSounds.begin(), affectedSounds.end());
+	affectedSounds.removeRange((int)(end - affectedSounds.begin()), affectedSounds.size());
+
+	auto setDelayPreload = [&](bool shouldDelay)
+	{
+		for (auto s : affectedSounds)
+		{
+			for (int i = 0; i < s->getNumMultiMicSamples(); i++)
+			{
+				if (auto st = s->getReferenceToSound(i))
+					st->setDelayPreloadInitialisation(shouldDelay);
+			}
+		}
+	};
+
+	// Delay the preload buffer update so that each sound is only reloaded once
+	setDelayPreload(true);
+
+	for (const auto& c : changes)
+	{
+		if (!ModulatorSamplerSound::isAsyncProperty(c.id) || c.id == SampleIds::SampleState)
+			continue;
+
+		for (int i = 0; i < c.sounds.size(); i++)
+		{
+			auto s = static_cast<ModulatorSamplerSound*>(c.sounds[i].get());
+
+			if (!s->isDeletePending())
+				s->updateAsyncInternalData(c.id, c.values[i]);
+		}
+	}
+
+	setDelayPreload(false);
+
+	// Purging handles the preload buffer itself
+	for (const auto& c : changes)
+	{
+		if (c.id != SampleIds::SampleState)
+			continue;
+
+		for (int i = 0; i < c.sounds.size(); i++)
+		{
+			auto s = static_cast<ModulatorSamplerSound*>(c.sounds[i].get());
+
+			if (!s->isDeletePending())
+				s->updateAsyncInternalData(c.id, c.values[i]);
+		}
+	}
+}
+
 } // namespace hise
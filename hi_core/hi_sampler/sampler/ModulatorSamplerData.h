@@ -59,6 +59,14 @@ class SampleMap: public SafeChangeListener,
 {
 public:
 
+	/** A list of changes for a single property of multiple sounds. */
+	struct PropertyColumn
+	{
+		Identifier id;
+		Array<SynthesiserSound::Ptr> sounds;
+		Array<var> values;
+	};
+
 	class Listener
 	{
 	public:
@@ -72,6 +80,9 @@ public:
 			ignoreUnused(s, id, newValue);
 		};
 
+		/** Called once after a PropertyTransaction was applied. The default implementation calls samplePropertyWasChanged() for every change. */
+		virtual void samplePropertiesWereChanged(const Array<PropertyColumn>& changes);
+
 		virtual void sampleAmountChanged() {};
 
 		virtual void sampleMapCleared() {};
@@ -245,6 +256,48 @@ public:
 
 	bool& getSyncEditModeFlag() { return syncEditMode; }
 
+	/** Collects property changes for the sounds of this sample map and applies them in a single pass.
+
+		Setting a property on a sound causes a listener callback, an update message and (for the sample
+		range properties) a reload of the preload buffer, which gets very slow if you edit thousands of
+		sounds at once. This class stores the changes in columns (one per property) and applies them with
+		a single voice kill. The preload buffer of each sound is reloaded only once and the listeners get
+		a single samplePropertiesWereChanged() call.
+	*/
+	class PropertyTransaction
+	{
+	public:
+
+		PropertyTransaction(SampleMap& parent_);
+
+		/** Adds a property change to this transaction. */
+		void set(ModulatorSamplerSound* sound, const Identifier& id, const var& newValue);
+
+		/** Returns the number of changes that are waiting to be applied. */
+		int getNumChanges() const;
+
+		/** Applies the changes. If useUndo is true, the changes will be added as a single undo transaction. */
+		void apply(bool useUndo);
+
+	private:
+
+		friend class SampleMap;
+
+		static PropertyColumn& getColumn(Array<PropertyColumn>& list, const Identifier& id);
+
+		static void applyAsyncChanges(const Array<PropertyColumn>& changes);
+
+		void propertyWasChanged(ValueTree& v, const Identifier& id);
+
+		SampleMap& parent;
+		ModulatorSamplerSound* currentSound = nullptr;
+
+		Array<PropertyColumn> pendingChanges;
+		Array<PropertyColumn> appliedChanges;
+
+		JUCE_DECLARE_NON_COPYABLE(PropertyTransaction);
+	};
+
 	struct ScopedNotificationDelayer
 	{
 		ScopedNotificationDelayer(SampleMap& parent_) :
@@ -340,6 +393,10 @@ private:
 	
 	bool syncEditMode = false;
 
+	// Only the changes of the thread that applies the transaction are captured
+	PropertyTransaction* currentTransaction = nullptr;
+	std::atomic<Thread::ThreadID> transactionThread = { nullptr };
+
 	valuetree::PropertyListener crossfadeListener;
 
 	struct Notifier: public Dispatchable
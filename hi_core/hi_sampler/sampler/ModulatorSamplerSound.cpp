@@ -568,6 +568,43 @@ void ModulatorSamplerSound::setPurged(bool shouldBePurged)
 	
 }
 
+void ModulatorSamplerSound::setPurgedAndRefreshPreload(bool shouldBePurged, int preloadSize)
+{
+	// Purge it first so that it can't be started while the buffers are released
+	if (shouldBePurged)
+		SynthSoundWithBitmask::setPurged(true);
+
+	if (noteRangeExceedsMaxPitch())
+		preloadSize = -1;
+
+	for (int i = 0; i < soundArray.size(); i++)
+	{
+		if (auto s = soundArray[i])
+		{
+			auto soundPurged = shouldBePurged || purgeChannels[i];
+
+			s->setPurged(soundPurged);
+			s->setPreloadSize(soundPurged ? 0 : preloadSize, true);
+		}
+	}
+
+	if (!shouldBePurged)
+		SynthSoundWithBitmask::setPurged(false);
+}
+
+int64 ModulatorSamplerSound::getPreloadMemoryUsage() const
+{
+	int64 numBytes = 0;
+
+	for (auto s : soundArray)
+	{
+		if (s != nullptr)
+			numBytes += (int64)s->getActualPreloadSize();
+	}
+
+	return numBytes;
+}
+
 void ModulatorSamplerSound::checkFileReference()
 {
 	allFilesExist = true;
@@ -426,6 +426,8 @@ public:
 
 	
 	void setPurged(bool shouldBePurged) override;
+	void setPurgedAndRefreshPreload(bool shouldBePurged, int preloadSize) override;
+	int64 getPreloadMemoryUsage() const override;
 	void checkFileReference();
 	bool isMissing() const noexcept
 	{
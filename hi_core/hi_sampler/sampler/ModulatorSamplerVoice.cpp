@@ -96,6 +96,7 @@ void ModulatorSamplerVoice::startNote(int midiNoteNumber,
 	jassert(s != nullptr);
 
 	currentlyPlayingSamplerSound = static_cast<ModulatorSamplerSound*>(s);
+	activeSamplerSound.store(currentlyPlayingSamplerSound);
     
 	velocityXFadeValue = currentlyPlayingSamplerSound->getGainValueForVelocityXFade((int)(velocity * 127.0f));
 	
@@ -433,6 +434,7 @@ void ModulatorSamplerVoice::resetVoice()
 	
 	firstInVoice = true;
 	wrappedVoice.resetVoice();
+	activeSamplerSound.store(nullptr);
 
 	ModulatorSynthVoice::resetVoice();
 
@@ -457,7 +459,8 @@ wrappedVoice(sampler->getBackgroundThreadPool())
 
 
 MultiMicModulatorSamplerVoice::MultiMicModulatorSamplerVoice(ModulatorSynth *ownerSynth, int numMultiMics):
-ModulatorSamplerVoice(ownerSynth)
+ModulatorSamplerVoice(ownerSynth),
+loaderGroup(ownerSynth->getMainController()->getSampleManager().getGlobalSampleThreadPool())
 {
 	wrappedVoices.clear();
 
@@ -470,10 +473,13 @@ ModulatorSamplerVoice(ownerSynth)
 		wrappedVoices.getLast()->setLoaderBufferSize((int)getOwnerSynth()->getAttribute(ModulatorSampler::BufferSize));
 		wrappedVoices.getLast()->setTemporaryVoiceBuffer(ms->getTemporaryVoiceBuffer(), ms->getTemporaryStretchBuffer());
 		wrappedVoices.getLast()->setDebugLogger(&ownerSynth->getMainController()->getDebugLogger());
+		loaderGroup.addLoader(&wrappedVoices.getLast()->loader);
         
         wrappedVoices.getLast()->setSuspendOnDelayedStartFunction(std::bind(&ModulatorSynth::syncAfterDelayStart, ownerSynth, std::placeholders::_1, std::placeholders::_2), getVoiceIndex());
 	}
 
+	fusedPairs.ensureStorageAllocated(numMultiMics);
+
 	// just call this once...
 	wrappedVoices.getFirst()->setSuspendOnDelayedStartFunction(std::bind(&ModulatorSynth::syncAfterDelayStart, ownerSynth, std::placeholders::_1, std::placeholders::_2), getVoiceIndex());
 }
@@ -526,6 +532,7 @@ void MultiMicModulatorSamplerVoice::startNote(int midiNoteNumber, float velocity
 #endif
 
 	currentlyPlayingSamplerSound = static_cast<ModulatorSamplerSound*>(s);
+	activeSamplerSound.store(currentlyPlayingSamplerSound);
 
 	velocityXFadeValue = currentlyPlayingSamplerSound->getGainValueForVelocityXFade((int)(velocity * 127.0f));
 	
@@ -569,7 +576,9 @@ void MultiMicModulatorSamplerVoice::calculateBlock(int startSample, int numSampl
 
 	voiceBuffer.clear();
 
-	for (int i = 0; i < wrappedVoices.size(); i++)
+	const bool renderedFused = renderFusedBlock(voicePitchValues, pitchCounter, uptimeDelta * propertyPitch, startSample, numSamples);
+
+	for (int i = 0; i < wrappedVoices.size() && !renderedFused; i++)
 	{
 		const StreamingSamplerSound *sound = wrappedVoices[i]->getLoadedSound();
 
@@ -675,6 +684,67 @@ void MultiMicModulatorSamplerVoice::calculateBlock(int startSample, int numSampl
 	}
 }
 
+bool MultiMicModulatorSamplerVoice::renderFusedBlock(const float* voicePitchValues, double pitchCounter, double thisUptimeDelta, int startSample, int numSamples)
+{
+	if (wrappedVoices.size() < 2)
+		return false;
+
+	fusedPairs.clearQuick();
+
+	double startAlpha = -1.0;
+
+	for (int i = 0; i < wrappedVoices.size(); i++)
+	{
+		auto v = wrappedVoices[i];
+
+		if (v->getLoadedSound() == nullptr)
+			continue;
+
+		v->setPitchValues(voicePitchValues);
+		v->setPitchCounterForThisBlock(pitchCounter);
+		v->uptimeDelta = thisUptimeDelta;
+
+		// All mic positions must be at the same fractional position to share the read positions
+		if (startAlpha < 0.0)
+			startAlpha = v->getStartAlpha();
+		else if (v->getStartAlpha() != startAlpha)
+			return false;
+
+		StreamingSamplerVoice::FusedChannelPair pair;
+
+		if (!v->prepareFusedBlock(voiceBuffer.getWritePointer(2 * i, startSample), voiceBuffer.getWritePointer(2 * i + 1, startSample), pair))
+			return false;
+
+		fusedPairs.add(pair);
+	}
+
+	if (fusedPairs.isEmpty())
+		return false;
+
+	StreamingSamplerVoice::interpolateFused(fusedPairs.getRawDataPointer(), fusedPairs.size(), voicePitchValues, startSample, startAlpha, thisUptimeDelta, numSamples);
+
+	for (int i = 0; i < wrappedVoices.size(); i++)
+	{
+		auto v = wrappedVoices[i];
+
+		// The voice might have been reset by a previous mic position
+		if (v->getLoadedSound() == nullptr)
+			continue;
+
+		float* channels[2] = { voiceBuffer.getWritePointer(2 * i), voiceBuffer.getWritePointer(2 * i + 1) };
+		AudioSampleBuffer channelBuffer(channels, 2, voiceBuffer.getNumSamples());
+
+		v->finishFusedBlock(channelBuffer, startSample, numSamples);
+
+		voiceUptime = v->voiceUptime;
+
+		if (!v->isActive)
+			resetVoice();
+	}
+
+	return true;
+}
+
 void MultiMicModulatorSamplerVoice::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
 	ModulatorSynthVoice::prepareToPlay(sampleRate, samplesPerBlock);
@@ -736,6 +806,8 @@ void MultiMicModulatorSamplerVoice::resetVoice()
 		wrappedVoices[i]->resetVoice();
 	}
 
+	activeSamplerSound.store(nullptr);
+
 	ModulatorSynthVoice::resetVoice();
 }
 
@@ -123,6 +123,12 @@ public:
 	*	do not access this member at startNote() and it will return nullptr.
 	*/
 	ModulatorSamplerSound *getCurrentlyPlayingSamplerSound() const 	{ return currentlyPlayingSamplerSound; }
+
+	/** Returns the sound of this voice or nullptr if the voice was reset. 
+	*
+	*	Unlike getCurrentlyPlayingSamplerSound() this can be called from a background thread.
+	*/
+	const ModulatorSamplerSound* getActiveSamplerSound() const noexcept { return activeSamplerSound.load(); }
 	
 	// ================================================================================================================
 
@@ -184,6 +190,7 @@ protected:
 
 	ScopedPointer<PlayFromPurger> playFromPurger;
 	std::atomic<bool> waitForPlayFromPurge = { false };
+	std::atomic<ModulatorSamplerSound*> activeSamplerSound = { nullptr };
 
 private:
 
@@ -274,6 +281,14 @@ public:
 
 private:
 
+	/** Interpolates all mic positions in a single pass if they share the playback state. */
+	bool renderFusedBlock(const float* voicePitchValues, double pitchCounter, double thisUptimeDelta, int startSample, int numSamples);
+
+	// Must be declared before the wrapped voices so that it outlives their loaders
+	SampleLoaderGroup loaderGroup;
+
+	Array<StreamingSamplerVoice::FusedChannelPair> fusedPairs;
+
 	OwnedArray<StreamingSamplerVoice> wrappedVoices;
 
 	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MultiMicModulatorSamplerVoice)
@@ -1148,6 +1148,8 @@ void SampleEditHandler::SampleEditingActions::automapUsingMetadata(ModulatorSamp
 
 	bool metadataWasFound = false;
 
+	SampleMap::PropertyTransaction t(*sampler->getSampleMap());
+
 	for (int i = 0; i < sounds.size(); i++)
 	{
 		PoolReference ref(sampler->getMainController(), sounds[i].get()->getSampleProperty(SampleIds::FileName).toString(), FileHandlerBase::Samples);
@@ -1172,11 +1174,13 @@ void SampleEditHandler::SampleEditingActions::automapUsingMetadata(ModulatorSamp
 				if(id == SampleIds::LoopEnd)
 					v++;
 
-				sounds[i]->setSampleProperty(id, v, true);
+				t.set(sounds[i].get(), id, v);
 			}
 		}
 	}
 
+	t.apply(true);
+
 	if (metadataWasFound) debugToConsole(sampler, "Metadata was found for imported samples");
 }
 
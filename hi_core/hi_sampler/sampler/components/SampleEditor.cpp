@@ -1846,25 +1846,59 @@ void SampleEditor::samplePropertyWasChanged(ModulatorSamplerSound* s, const Iden
 {
 	if (s == currentWaveForm->getCurrentSound() && SampleIds::Helpers::isAudioProperty(id))
 	{
-		if (id == SampleIds::SampleStartMod)
-		{
-			if (!getState(SampleMapCommands::EnableSampleStartArea))
-				perform(SampleMapCommands::EnableSampleStartArea);
-		}
-		if (id == SampleIds::SampleStart || id == SampleIds::SampleEnd)
-		{
-			if (!getState(SampleMapCommands::EnablePlayArea))
-				perform(SampleMapCommands::EnablePlayArea);
-		}
-		if (id == SampleIds::LoopEnabled || id == SampleIds::LoopEnd ||
-			id == SampleIds::LoopStart)
+		enableAreaForProperty(id);
+		currentWaveForm->updateRanges();
+	}	
+}
+
+void SampleEditor::samplePropertiesWereChanged(const Array<SampleMap::PropertyColumn>& changes)
+{
+	auto currentSound = currentWaveForm->getCurrentSound();
+
+	if (currentSound == nullptr)
+		return;
+
+	bool rangesChanged = false;
+
+	for (const auto& c : changes)
+	{
+		if (!SampleIds::Helpers::isAudioProperty(c.id))
+			continue;
+
+		for (auto s : c.sounds)
 		{
-			if (!getState(SampleMapCommands::EnableLoopArea))
-				perform(SampleMapCommands::EnableLoopArea);
+			if (static_cast<ModulatorSamplerSound*>(s.get()) == currentSound)
+			{
+				enableAreaForProperty(c.id);
+				rangesChanged = true;
+				break;
+			}
 		}
+	}
 
+	// Update the waveform only once for all changes
+	if (rangesChanged)
 		currentWaveForm->updateRanges();
-	}	
+}
+
+void SampleEditor::enableAreaForProperty(const Identifier& id)
+{
+	if (id == SampleIds::SampleStartMod)
+	{
+		if (!getState(SampleMapCommands::EnableSampleStartArea))
+			perform(SampleMapCommands::EnableSampleStartArea);
+	}
+	if (id == SampleIds::SampleStart || id == SampleIds::SampleEnd)
+	{
+		if (!getState(SampleMapCommands::EnablePlayArea))
+			perform(SampleMapCommands::EnablePlayArea);
+	}
+	if (id == SampleIds::LoopEnabled || id == SampleIds::LoopEnd ||
+		id == SampleIds::LoopStart)
+	{
+		if (!getState(SampleMapCommands::EnableLoopArea))
+			perform(SampleMapCommands::EnableLoopArea);
+	}
 }
 
 
@@ -2194,18 +2228,30 @@ void SampleEditor::mainSelectionChanged(SampleEditor& editor, ModulatorSamplerSo
 	editor.currentWaveForm->setSoundToDisplay(sound.get(), micIndex);
 
 	ScopedPointer<AudioFormatReader> afr;
+	File peakSource;
+	int64 peakOffset = 0;
 
 	if (sound != nullptr)
 	{
 		auto ss = sound->getReferenceToSound(micIndex);
 
 		if (ss->isMonolithic())
+		{
 			afr = ss->createReaderForPreview();
+			peakSource = ss->getMonolithFile();
+			peakOffset = ss->getMonolithOffset();
+		}
 		else
-			afr = PresetHandler::getReaderForFile(ss->getFileName(true));
+		{
+			auto fileName = ss->getFileName(true);
+			afr = PresetHandler::getReaderForFile(fileName);
+
+			if (File::isAbsolutePath(fileName))
+				peakSource = File(fileName);
+		}
 	}
 
-	editor.overview.setReader(afr.release());
+	editor.overview.setReader(afr.release(), -1, peakSource, peakOffset);
 }
 
 void SampleEditor::soundsSelected(int numSelected)
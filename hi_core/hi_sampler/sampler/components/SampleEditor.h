@@ -186,6 +186,8 @@ public:
 
 	void samplePropertyWasChanged(ModulatorSamplerSound* s, const Identifier& id, const var& newValue) override;
 
+	void samplePropertiesWereChanged(const Array<SampleMap::PropertyColumn>& changes) override;
+
 	void sampleAmountChanged() override
 	{
 		if(currentWaveForm->getCurrentSound() == nullptr)
@@ -314,6 +316,9 @@ private:
     //[UserVariables]   -- You can add your own custom variables in this section.
 	friend class SampleEditorToolbarFactory;
 
+	/** Shows the area of the waveform that is edited by the property. */
+	void enableAreaForProperty(const Identifier& id);
+
 	LookAndFeel_V4 slaf;
     ScrollbarFader::Laf laf;
     GlobalHiseLookAndFeel claf;
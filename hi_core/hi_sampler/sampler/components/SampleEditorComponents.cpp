@@ -1730,6 +1730,20 @@ void SamplerSoundTable::refreshPropertyForRow(int index, const Identifier& id)
 		table.repaintRow(index);
 }
 
+void SamplerSoundTable::refreshProperties(const Array<SampleMap::PropertyColumn>& changes)
+{
+	for (const auto& c : changes)
+	{
+		auto isGroupColumn = useComplexGroupManager && c.id == SampleIds::RRGroup;
+
+		if (isGroupColumn || (SampleIds::Helpers::isMapProperty(c.id) && columnIds.contains(c.id)))
+		{
+			table.repaint();
+			return;
+		}
+	}
+}
+
 void SamplerSoundTable::cellClicked(int rowNumber, int columnId, const MouseEvent& mouseEvent)
 {
 	if(isComplexGroupColumn(columnId) && mouseEvent.mods.isRightButtonDown())
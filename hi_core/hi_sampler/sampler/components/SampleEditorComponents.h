@@ -628,6 +628,9 @@ public:
 
 	void refreshPropertyForRow(int index, const Identifier& id);
 
+	/** Repaints the table once if one of the changed properties is displayed. */
+	void refreshProperties(const Array<SampleMap::PropertyColumn>& changes);
+
 	void cellClicked(int rowNumber, int columnId, const MouseEvent&mouseEvent) override;
 
 private:
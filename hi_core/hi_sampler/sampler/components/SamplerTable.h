@@ -120,6 +120,11 @@ public:
 		}
 	}
 
+	void samplePropertiesWereChanged(const Array<SampleMap::PropertyColumn>& changes) override
+	{
+		table->refreshProperties(changes);
+	}
+
 	void sampleMapWasChanged(PoolReference newSampleMap) override
 	{
 		refreshList();
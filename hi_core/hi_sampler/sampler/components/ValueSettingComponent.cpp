@@ -223,6 +223,11 @@ void ValueSettingComponent::setPropertyForAllSelectedSounds(const Identifier& p,
 		currentSelection[0]->startPropertyChange(p, newValue);
 	};
 
+	if (sampler.get() == nullptr)
+		return;
+
+	SampleMap::PropertyTransaction t(*sampler->getSampleMap());
+
 	for (int i = 0; i < currentSelection.size(); i++)
 	{
 		const int low = currentSelection[i]->getPropertyRange(soundProperty).getStart();
@@ -230,11 +235,11 @@ void ValueSettingComponent::setPropertyForAllSelectedSounds(const Identifier& p,
 
 		const int clippedValue = jlimit(low, high, newValue);
 
-		currentSelection[i]->setSampleProperty(p, clippedValue);
-
-
+		t.set(currentSelection[i].get(), p, clippedValue);
 	}
 
+	t.apply(true);
+
 	SampleEditor* editor = findParentComponentOfClass<SampleEditor>();
 
 	if (editor != nullptr)
@@ -374,10 +379,15 @@ void ValueSettingComponent::mouseDoubleClick(const MouseEvent& event)
 	if (event.mods.isRightButtonDown())
 		return;
 
+	if (sampler.get() == nullptr)
+		return;
+
+	SampleMap::PropertyTransaction t(*sampler->getSampleMap());
+
 	for(auto s: currentSelection)
-	{
-		s->setSampleProperty(soundProperty, s->getDefaultValue(soundProperty));
-	}
+		t.set(s.get(), soundProperty, s->getDefaultValue(soundProperty));
+
+	t.apply(true);
 
 	updateValue();
 }
@@ -34,6 +34,74 @@ namespace hise
 {
 using namespace juce;
 
+#if !HISE_IOS
+namespace filter_simd
+{
+
+/** Packs up to four channels of a buffer into the lanes of a SSE register.
+
+	The filter subtypes use this to process all channels with a single instruction stream and keep
+	their state in registers for the entire block instead of reloading it from the member arrays for
+	each sample and channel.
+*/
+struct ChannelLanes
+{
+	static constexpr int NumLanes = 4;
+
+	ChannelLanes(AudioSampleBuffer& b, int channelOffset, int startSample):
+	  numLanes(jmin(NumLanes, b.getNumChannels() - channelOffset))
+	{
+		for (int c = 0; c < numLanes; c++)
+			d[c] = b.getWritePointer(channelOffset + c, startSample);
+	}
+
+	__m128 load(int i) const
+	{
+		alignas(16) float x[NumLanes] = { 0.0f, 0.0f, 0.0f, 0.0f };
+
+		for (int c = 0; c < numLanes; c++)
+			x[c] = d[c][i];
+
+		return _mm_load_ps(x);
+	}
+
+	void store(int i, __m128 v)
+	{
+		alignas(16) float x[NumLanes];
+		_mm_store_ps(x, v);
+
+		for (int c = 0; c < numLanes; c++)
+			d[c][i] = x[c];
+	}
+
+	/** Loads the state for the lanes from a strided array (unused lanes are zero). */
+	__m128 loadState(const float* s, int stride=1) const
+	{
+		alignas(16) float x[NumLanes] = { 0.0f, 0.0f, 0.0f, 0.0f };
+
+		for (int c = 0; c < numLanes; c++)
+			x[c] = s[c * stride];
+
+		return _mm_load_ps(x);
+	}
+
+	/** Writes back the state of the used lanes. */
+	void storeState(float* s, __m128 v, int stride=1) const
+	{
+		alignas(16) float x[NumLanes];
+		_mm_store_ps(x, v);
+
+		for (int c = 0; c < numLanes; c++)
+			s[c * stride] = x[c];
+	}
+
+	const int numLanes;
+	float* d[NumLanes];
+};
+
+}
+#endif
+
 
 double FilterLimits::limit(double minValue, double maxValue, double value)
 {
@@ -388,7 +456,63 @@ void MoogFilterSubType::updateCoefficients(double sampleRate, double frequency,
 
 void MoogFilterSubType::processSamples(AudioSampleBuffer& buffer, int startSample, int numSamples)
 {
-	for (int c = 0; c < buffer.getNumChannels(); c++)
+	int c = 0;
+
+#if !HISE_IOS
+	// Process channel pairs in the two lanes of a SSE2 double register
+	const __m128d fbv = _mm_set1_pd(fb);
+	const __m128d gainv = _mm_set1_pd(0.35013 * fss);
+	const __m128d invFv = _mm_set1_pd(invF);
+	const __m128d pointThree = _mm_set1_pd(0.3);
+
+	for (; c + 1 < buffer.getNumChannels(); c += 2)
+	{
+		float* l = buffer.getWritePointer(c, startSample);
+		float* r = buffer.getWritePointer(c + 1, startSample);
+
+		auto i1 = _mm_loadu_pd(in1 + c);
+		auto i2 = _mm_loadu_pd(in2 + c);
+		auto i3 = _mm_loadu_pd(in3 + c);
+		auto i4 = _mm_loadu_pd(in4 + c);
+		auto o1 = _mm_loadu_pd(out1 + c);
+		auto o2 = _mm_loadu_pd(out2 + c);
+		auto o3 = _mm_loadu_pd(out3 + c);
+		auto o4 = _mm_loadu_pd(out4 + c);
+
+		for (int i = 0; i < numSamples; i++)
+		{
+			auto input = _mm_set_pd((double)r[i], (double)l[i]);
+
+			input = _mm_sub_pd(input, _mm_mul_pd(o4, fbv));
+			input = _mm_mul_pd(input, gainv);
+			o1 = _mm_add_pd(_mm_add_pd(input, _mm_mul_pd(pointThree, i1)), _mm_mul_pd(invFv, o1));
+			i1 = input;
+			o2 = _mm_add_pd(_mm_add_pd(o1, _mm_mul_pd(pointThree, i2)), _mm_mul_pd(invFv, o2));
+			i2 = o1;
+			o3 = _mm_add_pd(_mm_add_pd(o2, _mm_mul_pd(pointThree, i3)), _mm_mul_pd(invFv, o3));
+			i3 = o2;
+			o4 = _mm_add_pd(_mm_add_pd(o3, _mm_mul_pd(pointThree, i4)), _mm_mul_pd(invFv, o4));
+			i4 = o3;
+
+			alignas(16) double out[2];
+			_mm_store_pd(out, o4);
+
+			l[i] = 2.0f * (float)out[0];
+			r[i] = 2.0f * (float)out[1];
+		}
+
+		_mm_storeu_pd(in1 + c, i1);
+		_mm_storeu_pd(in2 + c, i2);
+		_mm_storeu_pd(in3 + c, i3);
+		_mm_storeu_pd(in4 + c, i4);
+		_mm_storeu_pd(out1 + c, o1);
+		_mm_storeu_pd(out2 + c, o2);
+		_mm_storeu_pd(out3 + c, o3);
+		_mm_storeu_pd(out4 + c, o4);
+	}
+#endif
+
+	for (; c < buffer.getNumChannels(); c++)
 	{
 		float* d = buffer.getWritePointer(c, startSample);
 
@@ -874,6 +998,36 @@ void LadderSubType::setType(int /*t*/)
 
 void LadderSubType::processSamples(AudioSampleBuffer& b, int startSample, int numSamples)
 {
+#if !HISE_IOS
+	const auto cutv = _mm_set1_ps(cut);
+	const auto resv = _mm_set1_ps(res);
+	const auto two = _mm_set1_ps(2.0f);
+
+	for (int offset = 0; offset < b.getNumChannels(); offset += filter_simd::ChannelLanes::NumLanes)
+	{
+		filter_simd::ChannelLanes lanes(b, offset, startSample);
+
+		auto b0 = lanes.loadState(&buf[offset][0], 4);
+		auto b1 = lanes.loadState(&buf[offset][1], 4);
+		auto b2 = lanes.loadState(&buf[offset][2], 4);
+		auto b3 = lanes.loadState(&buf[offset][3], 4);
+
+		for (int i = 0; i < numSamples; i++)
+		{
+			const auto in = _mm_sub_ps(lanes.load(i), _mm_mul_ps(b3, resv));
+			b0 = _mm_add_ps(_mm_mul_ps(_mm_sub_ps(in, b0), cutv), b0);
+			b1 = _mm_add_ps(_mm_mul_ps(_mm_sub_ps(b0, b1), cutv), b1);
+			b2 = _mm_add_ps(_mm_mul_ps(_mm_sub_ps(b1, b2), cutv), b2);
+			b3 = _mm_add_ps(_mm_mul_ps(_mm_sub_ps(b2, b3), cutv), b3);
+			lanes.store(i, _mm_mul_ps(two, b3));
+		}
+
+		lanes.storeState(&buf[offset][0], b0, 4);
+		lanes.storeState(&buf[offset][1], b1, 4);
+		lanes.storeState(&buf[offset][2], b2, 4);
+		lanes.storeState(&buf[offset][3], b3, 4);
+	}
+#else
 	for (int c = 0; c < b.getNumChannels(); c++)
 	{
 		for (int i = 0; i < numSamples; i++)
@@ -882,6 +1036,7 @@ void LadderSubType::processSamples(AudioSampleBuffer& b, int startSample, int nu
 			*d = processSample(*d, c);
 		}
 	}
+#endif
 }
 
 void LadderSubType::processFrame(float* d, int numChannels)
@@ -993,10 +1148,65 @@ void StateVariableFilterSubType::updateCoefficients(double sampleRate, double fr
 	}
 }
 
+#if !HISE_IOS
+template <int Mode> static void processStateVariableLanes(AudioSampleBuffer& buffer, int startSample, int numSamples, float* v0z, float* z1_A, float* v2, float g1, float g2, float g3, float g4, float k)
+{
+	const auto g1v = _mm_set1_ps(g1);
+	const auto g2v = _mm_set1_ps(g2);
+	const auto g3v = _mm_set1_ps(g3);
+	const auto g4v = _mm_set1_ps(g4);
+	const auto kv = _mm_set1_ps(k);
+	const auto two = _mm_set1_ps(2.0f);
+
+	for (int offset = 0; offset < buffer.getNumChannels(); offset += filter_simd::ChannelLanes::NumLanes)
+	{
+		filter_simd::ChannelLanes lanes(buffer, offset, startSample);
+
+		auto s0 = lanes.loadState(v0z + offset);
+		auto s1 = lanes.loadState(z1_A + offset);
+		auto s2 = lanes.loadState(v2 + offset);
+
+		for (int i = 0; i < numSamples; i++)
+		{
+			const auto v0 = lanes.load(i);
+			const auto v1z = s1;
+			const auto v3 = _mm_sub_ps(_mm_add_ps(v0, s0), _mm_mul_ps(two, s2));
+
+			s1 = _mm_add_ps(s1, _mm_sub_ps(_mm_mul_ps(g1v, v3), _mm_mul_ps(g2v, v1z)));
+			s2 = _mm_add_ps(s2, _mm_add_ps(_mm_mul_ps(g3v, v3), _mm_mul_ps(g4v, v1z)));
+			s0 = v0;
+
+			switch (Mode)
+			{
+			case StateVariableFilterSubType::LP:	lanes.store(i, s2); break;
+			case StateVariableFilterSubType::BP:	lanes.store(i, s1); break;
+			case StateVariableFilterSubType::HP:	lanes.store(i, _mm_sub_ps(_mm_sub_ps(v0, _mm_mul_ps(kv, s1)), s2)); break;
+			case StateVariableFilterSubType::NOTCH:	lanes.store(i, _mm_sub_ps(v0, _mm_mul_ps(kv, s1))); break;
+			}
+		}
+
+		lanes.storeState(v0z + offset, s0);
+		lanes.storeState(z1_A + offset, s1);
+		lanes.storeState(v2 + offset, s2);
+	}
+}
+#endif
+
 void StateVariableFilterSubType::processSamples(AudioSampleBuffer& buffer, int startSample, int numSamples)
 {
 	auto numChannels = buffer.getNumChannels();
 
+#if !HISE_IOS
+	switch (type)
+	{
+	case LP:	 processStateVariableLanes<LP>(buffer, startSample, numSamples, v0z, z1_A, v2, g1, g2, g3, g4, k); return;
+	case BP:	 processStateVariableLanes<BP>(buffer, startSample, numSamples, v0z, z1_A, v2, g1, g2, g3, g4, k); return;
+	case HP:	 processStateVariableLanes<HP>(buffer, startSample, numSamples, v0z, z1_A, v2, g1, g2, g3, g4, k); return;
+	case NOTCH: processStateVariableLanes<NOTCH>(buffer, startSample, numSamples, v0z, z1_A, v2, g1, g2, g3, g4, k); return;
+	default:	 break;
+	}
+#endif
+
 	switch (type)
 	{
 	case LP:
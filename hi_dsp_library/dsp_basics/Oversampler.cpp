@@ -0,0 +1,481 @@
+/*  ===========================================================================
+ *
+ *   This file is part of HISE.
+ *   Copyright 2016 Christoph Hart
+ *
+ *   HISE is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   HISE is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Commercial licenses for using HISE in an closed source project are
+ *   available on request. Please visit the project's website to get more
+ *   information about commercial licensing:
+ *
+ *   http://www.hise.audio/
+ *
+ *   HISE is based on the JUCE library,
+ *   which also must be licenced for commercial applications:
+ *
+ *   http://www.juce.com
+ *
+ *   ===========================================================================
+ */
+
+
+namespace hise { using namespace juce;
+
+namespace OversamplerHelpers
+{
+#if JUCE_USE_SIMD
+using SIMDType = dsp::SIMDRegister<float>;
+static constexpr int SIMDWidth = (int)SIMDType::SIMDNumElements;
+#else
+static constexpr int SIMDWidth = 1;
+#endif
+
+static float* getAlignedPtr(float* ptr)
+{
+#if JUCE_USE_SIMD
+	return SIMDType::getNextSIMDAlignedPtr(ptr);
+#else
+	return ptr;
+#endif
+}
+
+static int roundUpToSIMDWidth(int numElements)
+{
+	return (numElements + SIMDWidth - 1) / SIMDWidth * SIMDWidth;
+}
+
+/** Both pointers must be aligned and the size must be a multiple of the SIMD width. */
+static forcedinline float dotProduct(const float* data, const float* kernel, int kernelSize)
+{
+#if JUCE_USE_SIMD
+	auto acc = SIMDType::expand(0.0f);
+
+	for (int i = 0; i < kernelSize; i += SIMDWidth)
+		acc = SIMDType::multiplyAdd(acc, SIMDType::fromRawArray(data + i), SIMDType::fromRawArray(kernel + i));
+
+	return acc.sum();
+#else
+	float acc = 0.0f;
+
+	for (int i = 0; i < kernelSize; i++)
+		acc += data[i] * kernel[i];
+
+	return acc;
+#endif
+}
+
+static double besselI0(double x)
+{
+	double sum = 1.0;
+	double term = 1.0;
+
+	for (int k = 1; term > 1e-12 * sum; k++)
+	{
+		auto f = x / (2.0 * (double)k);
+		term *= f * f;
+		sum += term;
+	}
+
+	return sum;
+}
+
+/** Allpass coefficient design for half-band polyphase filters (see Laurent de Soras' HIIR library). */
+static double computeAllpassCoefficient(int index, double k, double q, int order)
+{
+	auto c = (double)(index + 1);
+
+	double num = 0.0;
+	double term = 0.0;
+
+	for (int i = 0, sign = 1; i == 0 || std::abs(term) > 1e-100; i++, sign = -sign)
+	{
+		term = std::pow(q, (double)(i * (i + 1))) * std::sin((double)(i * 2 + 1) * c * double_Pi / (double)order) * (double)sign;
+		num += term;
+	}
+
+	double den = 0.0;
+
+	for (int i = 1, sign = -1; i == 1 || std::abs(term) > 1e-100; i++, sign = -sign)
+	{
+		term = std::pow(q, (double)(i * i)) * std::cos((double)(i * 2) * c * double_Pi / (double)order) * (double)sign;
+		den += term;
+	}
+
+	auto ww = num * std::pow(q, 0.25) / (den + 0.5);
+	auto wwsq = ww * ww;
+
+	auto x = std::sqrt((1.0 - wwsq * k) * (1.0 - wwsq / k)) / (1.0 + wwsq);
+	return (1.0 - x) / (1.0 + x);
+}
+}
+
+PolyphaseOversampler::CoefficientCache::FIRKernel::FIRKernel(int numTaps_, double attenuationDb) :
+	numTaps(numTaps_),
+	centreDelay(numTaps_ / 2),
+	kernelSize(numTaps_ + OversamplerHelpers::SIMDWidth),
+	latency((float)(numTaps_ - 1))
+{
+	using namespace OversamplerHelpers;
+
+	jassert(numTaps % (2 * SIMDWidth) == 0);
+
+	// The full filter has 2 * numTaps - 1 coefficients and all even coefficients
+	// except for the centre (which is always 0.5) are zero. We only need to store
+	// the odd coefficients since the other branch is a pure delay.
+	const auto fullLength = 2 * numTaps - 1;
+	const auto centre = numTaps - 1;
+	const auto beta = 0.1102 * (attenuationDb - 8.7);
+
+	Array<double> b;
+	double sum = 0.0;
+
+	for (int i = 0; i < numTaps; i++)
+	{
+		auto k = 2 * i;
+		auto d = (double)(k - centre);
+		auto wPos = 2.0 * (double)k / (double)(fullLength - 1) - 1.0;
+		auto window = besselI0(beta * std::sqrt(1.0 - wPos * wPos)) / besselI0(beta);
+
+		b.add(std::sin(double_Pi * d * 0.5) / (double_Pi * d) * window);
+		sum += b.getLast();
+	}
+
+	// normalise so that the DC gain of the branch is exactly 0.5
+	for (auto& v : b)
+		v *= 0.5 / sum;
+
+	data.calloc(SIMDWidth * kernelSize + SIMDWidth);
+	kernels = getAlignedPtr(data.get());
+
+	// Store a time reversed copy for every offset to the next SIMD-aligned
+	// position so that the convolution never needs unaligned loads.
+	for (int offset = 0; offset < SIMDWidth; offset++)
+	{
+		auto k = kernels + offset * kernelSize;
+
+		for (int i = 0; i < numTaps; i++)
+			k[offset + i] = (float)b[numTaps - 1 - i];
+	}
+}
+
+PolyphaseOversampler::CoefficientCache::AllpassCascade::AllpassCascade(int numCoefficients, double transitionBandwidth)
+{
+	auto k = std::tan((1.0 - transitionBandwidth * 2.0) * double_Pi / 4.0);
+	k *= k;
+
+	auto kksqrt = std::pow(1.0 - k * k, 0.25);
+	auto e = 0.5 * (1.0 - kksqrt) / (1.0 + kksqrt);
+	auto e4 = e * e * e * e;
+	auto q = e * (1.0 + e4 * (2.0 + e4 * (15.0 + 150.0 * e4)));
+
+	const auto order = numCoefficients * 2 + 1;
+
+	// The group delay of a first order allpass in z^-2 at DC is 2 * (1 - c) / (1 + c)
+	// and the overall latency of the up- and downsampling is the average of both branches.
+	double groupDelay = 0.0;
+
+	for (int i = 0; i < numCoefficients; i++)
+	{
+		auto c = OversamplerHelpers::computeAllpassCoefficient(i, k, q, order);
+		coefficients[i % 2].add((float)c);
+		groupDelay += 2.0 * (1.0 - c) / (1.0 + c);
+	}
+
+	latency = (float)(groupDelay * 0.5);
+}
+
+PolyphaseOversampler::CoefficientCache::CoefficientCache() :
+	firstFIR(32, 90.0),
+	otherFIR(16, 80.0),
+	firstIIR(8, 0.06),
+	otherIIR(4, 0.2)
+{}
+
+PolyphaseOversampler::Stage::Stage(FilterType t, int stageIndex, const CoefficientCache& cache) :
+	type(t)
+{
+	if (type == FilterType::PolyphaseFIR)
+	{
+		fir = &cache.getFIRKernel(stageIndex);
+		upStateSize = fir->numTaps - 1;
+		downStateSize = fir->numTaps - 1 + fir->centreDelay;
+	}
+	else
+	{
+		iir = &cache.getAllpassCascade(stageIndex);
+		upStateSize = 2 * (iir->coefficients[0].size() + iir->coefficients[1].size());
+		downStateSize = upStateSize;
+	}
+}
+
+void PolyphaseOversampler::Stage::processUp(const float* input, float* output, int numInputSamples, float* s, float* scratch) const
+{
+	if (fir != nullptr)
+	{
+		using namespace OversamplerHelpers;
+
+		const auto numHistory = fir->numTaps - 1;
+		const auto centreDelay = fir->centreDelay;
+
+		FloatVectorOperations::copy(scratch, s, numHistory);
+		FloatVectorOperations::copy(scratch + numHistory, input, numInputSamples);
+
+		for (int i = 0; i < numInputSamples; i++)
+		{
+			auto offset = i % SIMDWidth;
+			auto kernel = fir->getRotatedKernel(offset);
+
+			output[2 * i] = 2.0f * dotProduct(scratch + i - offset, kernel, fir->kernelSize);
+			output[2 * i + 1] = scratch[i + centreDelay];
+		}
+
+		FloatVectorOperations::copy(s, scratch + numInputSamples, numHistory);
+	}
+	else
+	{
+		auto cA = iir->coefficients[0].begin();
+		auto cB = iir->coefficients[1].begin();
+		auto numA = iir->coefficients[0].size();
+		auto numB = iir->coefficients[1].size();
+
+		auto sA = s;
+		auto sB = s + 2 * numA;
+
+		for (int i = 0; i < numInputSamples; i++)
+		{
+			auto a = input[i];
+			auto b = a;
+
+			for (int j = 0; j < numA; j++)
+			{
+				auto y = (a - sA[2 * j + 1]) * cA[j] + sA[2 * j];
+				sA[2 * j] = a;
+				sA[2 * j + 1] = y;
+				a = y;
+			}
+
+			for (int j = 0; j < numB; j++)
+			{
+				auto y = (b - sB[2 * j + 1]) * cB[j] + sB[2 * j];
+				sB[2 * j] = b;
+				sB[2 * j + 1] = y;
+				b = y;
+			}
+
+			output[2 * i] = a;
+			output[2 * i + 1] = b;
+		}
+	}
+}
+
+void PolyphaseOversampler::Stage::processDown(const float* input, float* output, int numOutputSamples, float* s, float* scratch, float* scratch2) const
+{
+	if (fir != nullptr)
+	{
+		using namespace OversamplerHelpers;
+
+		const auto numHistory = fir->numTaps - 1;
+		const auto centreDelay = fir->centreDelay;
+
+		FloatVectorOperations::copy(scratch, s, numHistory);
+		FloatVectorOperations::copy(scratch2, s + numHistory, centreDelay);
+
+		for (int i = 0; i < numOutputSamples; i++)
+		{
+			scratch[numHistory + i] = input[2 * i];
+			scratch2[centreDelay + i] = input[2 * i + 1];
+		}
+
+		for (int i = 0; i < numOutputSamples; i++)
+		{
+			auto offset = i % SIMDWidth;
+			auto kernel = fir->getRotatedKernel(offset);
+
+			output[i] = dotProduct(scratch + i - offset, kernel, fir->kernelSize) + 0.5f * scratch2[i];
+		}
+
+		FloatVectorOperations::copy(s, scratch + numOutputSamples, numHistory);
+		FloatVectorOperations::copy(s + numHistory, scratch2 + numOutputSamples, centreDelay);
+	}
+	else
+	{
+		auto cA = iir->coefficients[0].begin();
+		auto cB = iir->coefficients[1].begin();
+		auto numA = iir->coefficients[0].size();
+		auto numB = iir->coefficients[1].size();
+
+		auto sA = s;
+		auto sB = s + 2 * numA;
+
+		for (int i = 0; i < numOutputSamples; i++)
+		{
+			auto a = input[2 * i + 1];
+			auto b = input[2 * i];
+
+			for (int j = 0; j < numA; j++)
+			{
+				auto y = (a - sA[2 * j + 1]) * cA[j] + sA[2 * j];
+				sA[2 * j] = a;
+				sA[2 * j + 1] = y;
+				a = y;
+			}
+
+			for (int j = 0; j < numB; j++)
+			{
+				auto y = (b - sB[2 * j + 1]) * cB[j] + sB[2 * j];
+				sB[2 * j] = b;
+				sB[2 * j + 1] = y;
+				b = y;
+			}
+
+			output[i] = 0.5f * (a + b);
+		}
+	}
+}
+
+PolyphaseOversampler::PolyphaseOversampler(int numChannels_, int factorExponent, FilterType type, int numVoices_) :
+	filterType(type),
+	numChannels(jmax(1, numChannels_)),
+	numVoices(jmax(1, numVoices_))
+{
+	factorExponent = jlimit(0, MaxOversamplingExponent, factorExponent);
+
+	for (int i = 0; i < factorExponent; i++)
+	{
+		auto s = stages.add(new Stage(filterType, i, *cache));
+
+		s->stateOffset = channelStride;
+		channelStride += s->upStateSize + s->downStateSize;
+
+		auto stageLatency = s->fir != nullptr ? s->fir->latency : s->iir->latency;
+		latency += stageLatency / (float)(1 << i);
+	}
+
+	voiceStride = channelStride * numChannels;
+
+	if (voiceStride > 0)
+	{
+		stateData.calloc(voiceStride * numVoices);
+		state = stateData.get();
+	}
+
+	passThroughChannels.calloc(numChannels);
+}
+
+PolyphaseOversampler::~PolyphaseOversampler()
+{
+	stages.clear();
+	stageBuffers.clear();
+}
+
+void PolyphaseOversampler::initProcessing(int maxBlockSize_)
+{
+	maxBlockSize = maxBlockSize_;
+
+	stageBuffers.clear();
+
+	if (stages.isEmpty())
+		return;
+
+	for (int i = 0; i < stages.size(); i++)
+		stageBuffers.add(new AudioBuffer<float>(numChannels, maxBlockSize << (i + 1)));
+
+	// The largest stage processes maxBlockSize << (numStages - 1) samples and the
+	// convolution reads up to one kernel (+ SIMD padding) past the last sample
+	auto maxNumTaps = cache->getFIRKernel(0).numTaps;
+	scratchSize = OversamplerHelpers::roundUpToSIMDWidth((maxBlockSize << (stages.size() - 1)) + maxNumTaps + OversamplerHelpers::SIMDWidth);
+
+	scratchData.calloc(2 * scratchSize + OversamplerHelpers::SIMDWidth);
+	scratch[0] = OversamplerHelpers::getAlignedPtr(scratchData.get());
+	scratch[1] = scratch[0] + scratchSize;
+
+	reset();
+}
+
+void PolyphaseOversampler::reset()
+{
+	if (state != nullptr)
+		FloatVectorOperations::clear(state, voiceStride * numVoices);
+}
+
+void PolyphaseOversampler::resetVoice(int voiceIndexToReset)
+{
+	if (state != nullptr && isPositiveAndBelow(voiceIndexToReset, numVoices))
+		FloatVectorOperations::clear(state + voiceIndexToReset * voiceStride, voiceStride);
+}
+
+dsp::AudioBlock<float> PolyphaseOversampler::processSamplesUp(const dsp::AudioBlock<const float>& inputBlock)
+{
+	auto numChannelsToProcess = jmin(numChannels, (int)inputBlock.getNumChannels());
+	auto numSamples = (int)inputBlock.getNumSamples();
+
+	if (stages.isEmpty())
+	{
+		for (int c = 0; c < numChannelsToProcess; c++)
+			passThroughChannels[c] = const_cast<float*>(inputBlock.getChannelPointer(c));
+
+		return dsp::AudioBlock<float>(passThroughChannels.get(), (size_t)numChannelsToProcess, (size_t)numSamples);
+	}
+
+	// You need to call initProcessing() with the correct block size
+	jassert(numSamples <= maxBlockSize);
+	numSamples = jmin(numSamples, maxBlockSize);
+	lastNumSamples = numSamples;
+
+	for (int c = 0; c < numChannelsToProcess; c++)
+	{
+		auto input = inputBlock.getChannelPointer(c);
+		auto numThisStage = numSamples;
+
+		for (int i = 0; i < stages.size(); i++)
+		{
+			auto s = stages[i];
+			auto output = stageBuffers[i]->getWritePointer(c);
+
+			s->processUp(input, output, numThisStage, getState(c, *s), scratch[0]);
+
+			input = output;
+			numThisStage *= 2;
+		}
+	}
+
+	auto& lastBuffer = *stageBuffers.getLast();
+
+	return dsp::AudioBlock<float>(lastBuffer.getArrayOfWritePointers(), (size_t)numChannelsToProcess, (size_t)(numSamples << stages.size()));
+}
+
+void PolyphaseOversampler::processSamplesDown(dsp::AudioBlock<float>& outputBlock)
+{
+	// the pass through block was processed in place
+	if (stages.isEmpty())
+		return;
+
+	auto numChannelsToProcess = jmin(numChannels, (int)outputBlock.getNumChannels());
+	auto numSamples = jmin((int)outputBlock.getNumSamples(), lastNumSamples);
+
+	for (int c = 0; c < numChannelsToProcess; c++)
+	{
+		for (int i = stages.size() - 1; i >= 0; i--)
+		{
+			auto s = stages[i];
+			auto input = stageBuffers[i]->getReadPointer(c);
+			auto output = i == 0 ? outputBlock.getChannelPointer(c) : stageBuffers[i - 1]->getWritePointer(c);
+
+			s->processDown(input, output, numSamples << i, getState(c, *s) + s->upStateSize, scratch[0], scratch[1]);
+		}
+	}
+}
+
+}
@@ -0,0 +1,190 @@
+/*  ===========================================================================
+ *
+ *   This file is part of HISE.
+ *   Copyright 2016 Christoph Hart
+ *
+ *   HISE is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   HISE is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Commercial licenses for using HISE in an closed source project are
+ *   available on request. Please visit the project's website to get more
+ *   information about commercial licensing:
+ *
+ *   http://www.hise.audio/
+ *
+ *   HISE is based on the JUCE library,
+ *   which also must be licenced for commercial applications:
+ *
+ *   http://www.juce.com
+ *
+ *   ===========================================================================
+ */
+
+
+#pragma once
+
+namespace hise { using namespace juce;
+
+/** An oversampling engine with polyphase half-band stages.
+
+	This is a replacement for juce::dsp::Oversampling<float> which is optimised for the small
+	block sizes that are used in scriptnode and the voice effects. The oversampling is done in
+	cascaded 2x stages which are either:
+
+	- a polyphase half-band FIR filter (linear phase). The convolution of the polyphase branch
+	  uses SIMD instructions.
+	- a polyphase cascade of first order allpass filters (minimum phase with very low latency).
+
+	The filter coefficients are computed once and are shared between all instances. If you pass
+	in more than one voice, the filter state of all voices will be stored in a single allocation
+	and you can select the voice that should be processed with setVoiceIndex().
+*/
+class PolyphaseOversampler
+{
+public:
+
+	enum class FilterType
+	{
+		PolyphaseIIR = 0,
+		PolyphaseFIR,
+		numFilterTypes
+	};
+
+	static constexpr int MaxOversamplingExponent = 4;
+
+	/** The shared filter coefficients for the first stage and all following stages. */
+	struct CoefficientCache
+	{
+		/** The polyphase branch of a windowed sinc half-band filter. */
+		struct FIRKernel
+		{
+			FIRKernel(int numTaps, double attenuationDb);
+
+			/** Returns the time reversed coefficients shifted by the given offset so that they can be
+				used with aligned SIMD loads. */
+			const float* getRotatedKernel(int offset) const { return kernels + offset * kernelSize; }
+
+			int numTaps;
+			int centreDelay;
+			int kernelSize;
+			float latency;
+
+		private:
+
+			HeapBlock<float> data;
+			float* kernels;
+		};
+
+		/** The two branches of a half-band allpass cascade. */
+		struct AllpassCascade
+		{
+			AllpassCascade(int numCoefficients, double transitionBandwidth);
+
+			Array<float> coefficients[2];
+			float latency;
+		};
+
+		CoefficientCache();
+
+		const FIRKernel& getFIRKernel(int stageIndex) const { return stageIndex == 0 ? firstFIR : otherFIR; }
+		const AllpassCascade& getAllpassCascade(int stageIndex) const { return stageIndex == 0 ? firstIIR : otherIIR; }
+
+	private:
+
+		FIRKernel firstFIR, otherFIR;
+		AllpassCascade firstIIR, otherIIR;
+	};
+
+	PolyphaseOversampler(int numChannels, int factorExponent, FilterType type, int numVoices=1);
+
+	~PolyphaseOversampler();
+
+	/** Allocates the buffers for the given (non-oversampled) block size. */
+	void initProcessing(int maxBlockSize);
+
+	/** Clears the filter state of all voices. */
+	void reset();
+
+	/** Clears the filter state of a single voice. */
+	void resetVoice(int voiceIndex);
+
+	/** Selects the voice whose filter state is used by the next process calls. */
+	void setVoiceIndex(int newVoiceIndex) { voiceIndex = jlimit(0, numVoices - 1, newVoiceIndex); }
+
+	/** Upsamples the input and returns a block with the oversampled signal that can be processed in place. */
+	dsp::AudioBlock<float> processSamplesUp(const dsp::AudioBlock<const float>& inputBlock);
+
+	/** Downsamples the block that was returned by the last processSamplesUp() call into the given block. */
+	void processSamplesDown(dsp::AudioBlock<float>& outputBlock);
+
+	/** Returns the latency of the up- and downsampling at the original samplerate.
+	
+		For the IIR type this is the group delay at DC so it's not an integer value.
+	*/
+	float getLatencyInSamples() const { return latency; }
+
+	int getOversamplingFactor() const { return 1 << stages.size(); }
+	int getNumChannels() const { return numChannels; }
+	int getNumVoices() const { return numVoices; }
+	FilterType getFilterType() const { return filterType; }
+
+private:
+
+	struct Stage
+	{
+		Stage(FilterType t, int stageIndex, const CoefficientCache& cache);
+
+		void processUp(const float* input, float* output, int numInputSamples, float* state, float* scratch) const;
+		void processDown(const float* input, float* output, int numOutputSamples, float* state, float* scratch, float* scratch2) const;
+
+		const FilterType type;
+		const CoefficientCache::FIRKernel* fir = nullptr;
+		const CoefficientCache::AllpassCascade* iir = nullptr;
+
+		int upStateSize = 0;
+		int downStateSize = 0;
+		int stateOffset = 0;
+	};
+
+	float* getState(int channelIndex, const Stage& s) { return state + voiceIndex * voiceStride + channelIndex * channelStride + s.stateOffset; }
+
+	SharedResourcePointer<CoefficientCache> cache;
+
+	const FilterType filterType;
+	const int numChannels;
+	const int numVoices;
+
+	OwnedArray<Stage> stages;
+	OwnedArray<AudioBuffer<float>> stageBuffers;
+
+	int voiceIndex = 0;
+	int channelStride = 0;
+	int voiceStride = 0;
+
+	int maxBlockSize = 0;
+	int lastNumSamples = 0;
+	float latency = 0.0f;
+
+	HeapBlock<float> stateData;
+	float* state = nullptr;
+
+	HeapBlock<float> scratchData;
+	float* scratch[2] = { nullptr, nullptr };
+	int scratchSize = 0;
+
+	HeapBlock<float*> passThroughChannels;
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PolyphaseOversampler);
+};
+
+}
@@ -57,30 +57,35 @@ void Helpers::FFT::transformReadBuffer(AudioSampleBuffer& b)
 
 	auto delta = roundToInt(overlap * size);
 
-	auto order = log2(size);
-	auto fft = juce::dsp::FFT(order);
+	// Reuse the FFT engine and the work buffer for every block
+	if (fftObject == nullptr || fftObject->getSize() != size)
+	{
+		fftObject = new juce::dsp::FFT(roundToInt(std::log2(size)));
+		workBuffer.setSize(2, size * 2);
+	}
 
-	AudioSampleBuffer b2(2, size * 2);
+	auto decayToUse = decay;
 
-	for(int offset = 0; offset < b.getNumSamples() - (size-1); offset += delta)
+	if(overlap != 0.0)
 	{
-		b2.clear();
+		auto of = 1.0 / (1.0 - overlap);
 
-		auto data = b2.getWritePointer(0);
+		decayToUse = 1.0 - (1.0 - decay) / of;
+	}
+
+	for(int offset = 0; offset < b.getNumSamples() - (size-1); offset += delta)
+	{
+		workBuffer.clear();
 
-		auto src = b.getReadPointer(0, offset);
-		auto win = windowBuffer.getReadPointer(0);
+		auto data = workBuffer.getWritePointer(0);
 
-		for(int i = 0; i < size; i++)
-		{
-			data[i] = src[i] * win[i];
-		}
+		FloatVectorOperations::multiply(data, b.getReadPointer(0, offset), windowBuffer.getReadPointer(0), size);
 
-		fft.performRealOnlyForwardTransform(data, true);
+		fftObject->performRealOnlyForwardTransform(data, true);
 
 		auto useFreqDomain = true;
 
-		auto d = b2.getWritePointer(1);
+		auto d = workBuffer.getWritePointer(1);
 		int sIndex = 0;
 
 		d[0] = 0.0f;
@@ -119,39 +124,16 @@ void Helpers::FFT::transformReadBuffer(AudioSampleBuffer& b)
 			}
 		}
 
-		auto decayToUse = decay;
-
-		if(overlap != 0.0)
-		{
-			auto of = 1.0 / (1.0 - overlap);
-
-			decayToUse = 1.0 - (1.0 - decay) / of;
-		}
-
 		FloatVectorOperations::multiply(d, 1.0f / (float)size, size);
 
-		for (int i = 0; i < size; i++)
-		{
-			auto lastValue = lastBuffer.getSample(0, i);
-			auto thisValue = d[i];
+		auto lastValues = lastBuffer.getWritePointer(0);
 
-			float v;
+		FloatVectorOperations::multiply(lastValues, decayToUse, size);
 
-			if (usePeakDecay)
-			{
-				if (thisValue > lastValue)
-					v = thisValue;
-				else
-					v = lastValue * decayToUse;
-			}
-			else
-			{
-				v = lastValue * decayToUse + thisValue * (1.0f - decayToUse);
-			}
-
-			
-			lastBuffer.setSample(0, i, v);
-		}
+		if (usePeakDecay)
+			FloatVectorOperations::max(lastValues, lastValues, d, size);
+		else
+			FloatVectorOperations::addWithMultiply(lastValues, d, 1.0f - decayToUse, size);
 
 		if(delta == 0)
 			break;
@@ -121,8 +121,14 @@ struct Helpers
 
 		Path createPath(Range<int> sampleRange, Range<float> valueRange, Rectangle<float> targetBounds, double) const override;
 
+		bool transformOnBackgroundThread() const override { return true; }
+
 		void setProperty(const Identifier& id, const var& newValue) override
 		{
+			// The spectrum is calculated on a background thread
+			SimpleRingBuffer::Ptr rb = buffer.get();
+			ScopedLock sl(rb != nullptr ? rb->getReadBufferLock() : dummyLock);
+
 			auto key = id.toString();
 
 			if (key == "WindowType")
@@ -347,6 +353,10 @@ struct Helpers
 		mutable AudioSampleBuffer windowBuffer;
 		mutable AudioSampleBuffer lastBuffer;
 
+		ScopedPointer<juce::dsp::FFT> fftObject;
+		AudioSampleBuffer workBuffer;
+		CriticalSection dummyLock;
+
 		bool usePeakDecay = false;
 	};
 
@@ -80,9 +80,22 @@ struct table: public scriptnode::data::base
 
 	template <typename ProcessDataType> void process(ProcessDataType& data) noexcept
 	{
-		DataReadLock l(this);
+		if (auto s = DataSnapshotReader(this))
+		{
+			block snapshotData;
+			s.referBlockTo(snapshotData, 0);
+			processWithTable(data, snapshotData);
+		}
+		else
+		{
+			DataReadLock l(this);
+			processWithTable(data, tableData);
+		}
+	}
 
-		if (!tableData.isEmpty())
+	template <typename ProcessDataType> void processWithTable(ProcessDataType& data, block& t) noexcept
+	{
+		if (!t.isEmpty())
 		{
 			float v = 0.0f;
 
@@ -92,7 +105,7 @@ struct table: public scriptnode::data::base
 				{
 					ignoreUnused(s);
                     v = hmath::abs(v);
-					processFloat(v);
+					processFloat(v, t);
 				}
 			}
 
@@ -101,9 +114,14 @@ struct table: public scriptnode::data::base
 	}
 
 	void processFloat(float& s)
+	{
+		processFloat(s, tableData);
+	}
+
+	static void processFloat(float& s, block& t)
 	{
 		InterpolatorType ip(s);
-		s *= tableData[ip];
+		s *= t[ip];
 	}
 
 	void setExternalData(const ExternalData& d, int) override
@@ -114,16 +132,29 @@ struct table: public scriptnode::data::base
 
 	template <typename FrameDataType> void processFrame(FrameDataType& data) noexcept
 	{
-		DataReadLock l(this);
+		if (auto s = DataSnapshotReader(this))
+		{
+			block snapshotData;
+			s.referBlockTo(snapshotData, 0);
+			processFrameWithTable(data, snapshotData);
+		}
+		else
+		{
+			DataReadLock l(this);
+			processFrameWithTable(data, tableData);
+		}
+	}
 
+	template <typename FrameDataType> void processFrameWithTable(FrameDataType& data, block& t) noexcept
+	{
         float v = 0.0f;
         
-		if (!tableData.isEmpty())
+		if (!t.isEmpty())
 		{
 			for(auto& s: data)
             {
                 v = hmath::abs(s);
-                processFloat(v);
+                processFloat(v, t);
             }
             
             externalData.setDisplayedValue(v);
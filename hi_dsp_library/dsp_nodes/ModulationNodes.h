@@ -841,46 +841,42 @@ template <int NV> struct matrix_mod:
 		mv.setModValue(sd[0]);
 	}
 
+	/** Applies the source signal to the target buffer. The src buffer will contain the modulation value
+	    afterwards. This uses the vectorised operations because it's called for every connection. */
 	void applyModulation(float* dst, float* src, float* intensity, int numSamples)
 	{
 		if(inverted)
 		{
-			for(int i = 0; i < numSamples; i++)
-				src[i] = 1.0f - src[i];
+			FloatVectorOperations::negate(src, src, numSamples);
+			FloatVectorOperations::add(src, 1.0f, numSamples);
 		}
 
 		if (tm == modulation::TargetMode::Gain)
 		{
-			for(int i = 0; i < numSamples; i++)
-			{
-				auto in = intensity[i];
+			// mv = (1 - in) + in * src = 1 + in * (src - 1)
+			FloatVectorOperations::add(src, -1.0f, numSamples);
+			FloatVectorOperations::multiply(src, intensity, numSamples);
+			FloatVectorOperations::add(src, 1.0f, numSamples);
 
-				auto mv = (1.0f - in) + in * src[i];
+			if(zeroDelta != 0.0f)
+				FloatVectorOperations::add(dst, -zeroDelta, numSamples);
 
-				src[i] = mv;
+			FloatVectorOperations::multiply(dst, src, numSamples);
 
-				dst[i] -= zeroDelta;
-				dst[i] *= mv;
-				dst[i] += zeroDelta;
-			}
+			if(zeroDelta != 0.0f)
+				FloatVectorOperations::add(dst, zeroDelta, numSamples);
 		}
 		else if (tm == modulation::TargetMode::Bipolar)
 		{
-			for(int i = 0; i < numSamples; i++)
-			{
-				auto mv = src[i];
-				mv = 2.0f * mv - 1.0;
-				src[i] = mv * intensity[i];
-				dst[i] += src[i];
-			}
+			FloatVectorOperations::multiply(src, 2.0f, numSamples);
+			FloatVectorOperations::add(src, -1.0f, numSamples);
+			FloatVectorOperations::multiply(src, intensity, numSamples);
+			FloatVectorOperations::add(dst, src, numSamples);
 		}
 		else if (tm == modulation::TargetMode::Unipolar)
 		{
-			for(int i = 0; i < numSamples; i++)
-			{
-				src[i] *= intensity[i]; 
-				dst[i] += src[i];
-			}
+			FloatVectorOperations::multiply(src, intensity, numSamples);
+			FloatVectorOperations::add(dst, src, numSamples);
 		}
 	}
 
@@ -115,6 +115,29 @@ Set this to 1 if you want to embed the libraries created with this module into y
 #define HISE_LOG_FILTER_FREQMOD 0
 #endif
 
+/** Config: SNEX_USE_AVX
+
+	If enabled, the float spans will use 8-wide AVX instructions for their math operators if the size is a multiple of 8.
+	This is enabled automatically if the compiler targets AVX (/arch:AVX or -mavx) and the legacy CPU support is not enabled.
+*/
+#ifndef SNEX_USE_AVX
+#if defined(__AVX__) && !HI_ENABLE_LEGACY_CPU_SUPPORT && !JUCE_ARM
+#define SNEX_USE_AVX 1
+#else
+#define SNEX_USE_AVX 0
+#endif
+#endif
+
+/** Config: HISE_USE_COMPLEX_DATA_SNAPSHOTS
+
+	If enabled, tables that are connected to a node will publish an immutable snapshot for every 
+	change so that the nodes can read the data without waiting for the data lock (at the cost of 
+	a copy for every edit).
+*/
+#ifndef HISE_USE_COMPLEX_DATA_SNAPSHOTS
+#define HISE_USE_COMPLEX_DATA_SNAPSHOTS 0
+#endif
+
 /** Set the max delay time for the hise delay line class in samples. It must be a power of two. 
 
 	By default this means that the max delay time at 44kHz is ~1.5 seconds, so if you have long delay times
@@ -191,6 +214,7 @@ Set this to 1 if you want to embed the libraries created with this module into y
 #include "dsp_basics/DelayLine.cpp"
 #include "dsp_basics/Oscillators.h"
 #include "dsp_basics/MultiChannelFilters.h"
+#include "dsp_basics/Oversampler.h"
 
 
 #include "fft_convolver/Utilities.h"
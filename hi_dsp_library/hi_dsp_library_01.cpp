@@ -69,6 +69,7 @@
 #include "dsp_basics/AllpassDelay.cpp"
 #include "dsp_basics/Oscillators.cpp"
 #include "dsp_basics/MultiChannelFilters.cpp"
+#include "dsp_basics/Oversampler.cpp"
 
 #include "fft_convolver/Utilities.cpp"
 #include "fft_convolver/AudioFFT.cpp"
@@ -83,6 +84,9 @@
 #include "unit_test/node_tests.cpp"
 #include "unit_test/container_tests.cpp"
 #include "unit_test/uiupdater_tests.cpp"
+#include "unit_test/filter_tests.cpp"
+#include "unit_test/clone_tests.cpp"
+#include "unit_test/oversampler_tests.cpp"
 #endif
 
 #include "dsp_nodes/CoreNodes.cpp"
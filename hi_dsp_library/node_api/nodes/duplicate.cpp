@@ -34,4 +34,130 @@ namespace hise
 {
 using namespace juce;
 
-}
\ No newline at end of file
+}
+namespace scriptnode {
+namespace wrap {
+using namespace juce;
+
+clone_worker_pool::Worker::Worker(clone_worker_pool& p, int index) :
+	Thread("Clone Worker " + String(index + 1)),
+	parent(p)
+{}
+
+void clone_worker_pool::Worker::run()
+{
+	while (!threadShouldExit())
+	{
+		if (signal.wait(500))
+			parent.processTasks();
+	}
+}
+
+clone_worker_pool::~clone_worker_pool()
+{
+	jassert(numUsers == 0);
+
+	for (auto w : workers)
+		w->signalThreadShouldExit();
+
+	for (auto w : workers)
+	{
+		w->signal.signal();
+		w->stopThread(1000);
+	}
+}
+
+void clone_worker_pool::addUser()
+{
+	ScopedLock sl(userLock);
+
+	if (numUsers++ == 0)
+	{
+		// leave one core for the audio thread
+		auto numWorkers = jlimit(0, MaxNumWorkers, SystemStats::getNumCpus() - 1);
+
+		for (int i = 0; i < numWorkers; i++)
+			workers.add(new Worker(*this, i))->startThread(Thread::realtimeAudioPriority);
+	}
+}
+
+void clone_worker_pool::removeUser()
+{
+	ScopedLock sl(userLock);
+
+	jassert(numUsers > 0);
+
+	if (--numUsers == 0)
+	{
+		// the last user can't be processing anymore
+		jassert(!busy.load());
+
+		for (auto w : workers)
+			w->signalThreadShouldExit();
+
+		for (auto w : workers)
+		{
+			w->signal.signal();
+			w->stopThread(1000);
+		}
+
+		workers.clear();
+	}
+}
+
+void clone_worker_pool::run(Job& job, int numTasksToRun)
+{
+	auto expected = false;
+
+	if (numTasksToRun < 2 || workers.isEmpty() || !busy.compare_exchange_strong(expected, true))
+	{
+		for (int i = 0; i < numTasksToRun; i++)
+			job.processTask(i);
+
+		return;
+	}
+
+	numTasks.store(numTasksToRun);
+	nextTask.store(0);
+	numFinished.store(0);
+	currentJob.store(&job);
+
+	auto numWorkersToWake = jmin(workers.size(), numTasksToRun - 1);
+
+	for (int i = 0; i < numWorkersToWake; i++)
+		workers[i]->signal.signal();
+
+	processTasks();
+
+	while (numFinished.load() < numTasksToRun)
+		;
+
+	currentJob.store(nullptr);
+
+	// a worker might still be between picking up the job and noticing that there are no tasks left
+	while (numActiveThreads.load() != 0)
+		;
+
+	busy.store(false);
+}
+
+void clone_worker_pool::processTasks()
+{
+	++numActiveThreads;
+
+	if (auto job = currentJob.load())
+	{
+		auto numToRun = numTasks.load();
+
+		for (int i = nextTask++; i < numToRun; i = nextTask++)
+		{
+			job->processTask(i);
+			++numFinished;
+		}
+	}
+
+	--numActiveThreads;
+}
+
+} // namespace wrap
+} // namespace scriptnode
\ No newline at end of file
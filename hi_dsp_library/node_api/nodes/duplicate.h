@@ -45,12 +45,73 @@ enum class CloneProcessType
               // then adds the output to the original signal
     Copy,     // Copies the input signal, then processes each clone
               // and adds the output to the original signal
+    Multithreaded, // Like Copy, but distributes the clones across
+                   // the realtime threads of the clone_worker_pool
     Dynamic   // Allows a dynamic change for this module
 };
 
 namespace wrap
 {
 
+/** A pool of realtime threads that the clone containers use to process their clones in parallel.
+
+	The audio thread hands out the tasks, processes tasks itself until none are left and then
+	waits for the workers without acquiring any lock. If the pool is already used by another
+	clone container (eg. in another plugin instance), the caller will process all tasks itself.
+*/
+struct clone_worker_pool
+{
+	/** The maximum amount of worker threads. */
+	static constexpr int MaxNumWorkers = 7;
+
+	struct Job
+	{
+		virtual ~Job() {};
+
+		/** Will be called exactly once for every task index. */
+		virtual void processTask(int taskIndex) = 0;
+	};
+
+	~clone_worker_pool();
+
+	/** Registers a clone container. The worker threads will be started with the first user. */
+	void addUser();
+
+	/** Unregisters a clone container. The worker threads will be stopped with the last user. */
+	void removeUser();
+
+	/** Returns the amount of tasks that can be processed at the same time (including the calling thread). */
+	int getNumParallelTasks() const { return workers.size() + 1; }
+
+	/** Processes all tasks of the job and returns when they are finished. */
+	void run(Job& job, int numTasksToRun);
+
+private:
+
+	struct Worker : public Thread
+	{
+		Worker(clone_worker_pool& p, int index);
+
+		void run() override;
+
+		clone_worker_pool& parent;
+		WaitableEvent signal;
+	};
+
+	void processTasks();
+
+	CriticalSection userLock;
+	int numUsers = 0;
+	OwnedArray<Worker> workers;
+
+	std::atomic<bool> busy = { false };
+	std::atomic<Job*> currentJob = { nullptr };
+	std::atomic<int> numTasks = { 0 };
+	std::atomic<int> nextTask = { 0 };
+	std::atomic<int> numFinished = { 0 };
+	std::atomic<int> numActiveThreads = { 0 };
+};
+
 struct clone_manager
 {
 	struct Listener
@@ -287,7 +348,7 @@ template <typename DataType, CloneProcessType ProcessType>
 
     ~clone_base()
     {
-        
+        setUseWorkerPool(false);
     }
     
     CloneProcessType getProcessType() const
@@ -347,13 +408,40 @@ template <typename DataType, CloneProcessType ProcessType>
         if (pt > CloneProcessType::Serial)
             FrameConverters::increaseBuffer(workBuffer, lastSpecs);
         
-        if(pt == CloneProcessType::Copy)
+        if(pt >= CloneProcessType::Copy)
             FrameConverters::increaseBuffer(originalBuffer, lastSpecs);
 	}
 
+	void setUseWorkerPool(bool shouldUse)
+	{
+		if (shouldUse != usesWorkerPool)
+		{
+			usesWorkerPool = shouldUse;
+
+			if (usesWorkerPool)
+				workerPool->addUser();
+			else
+				workerPool->removeUser();
+		}
+	}
+
 	void prepare(PrepareSpecs ps)
 	{
 		lastSpecs = ps;
+
+        // The worker threads are started here once and run until the container is destroyed,
+        // so that a modulated SplitSignal parameter never starts or stops a thread.
+        if constexpr (ProcessType == CloneProcessType::Multithreaded || ProcessType == CloneProcessType::Dynamic)
+        {
+            setUseWorkerPool(true);
+
+            SimpleReadWriteLock::ScopedWriteLock sl(getCloneResizeLock());
+
+            // every task needs a work buffer and a buffer for the sum of its clones
+            numTaskSlots = workerPool->getNumParallelTasks();
+            taskBuffer.setSize(numTaskSlots * 2 * ps.numChannels * ps.blockSize);
+        }
+
 		resetCopyBuffer();
 
         SimpleReadWriteLock::ScopedReadLock sl(getCloneResizeLock());
@@ -401,6 +489,7 @@ template <typename DataType, CloneProcessType ProcessType>
                     break;
                 }
                 case CloneProcessType::Copy:
+                case CloneProcessType::Multithreaded:
                 {
                     FrameDataType original = frameData;
                     frameData = 0.0f;
@@ -424,7 +513,7 @@ template <typename DataType, CloneProcessType ProcessType>
 	{
 		constexpr int NumChannels = P;
 
-        bool shouldCopy = getProcessType() == CloneProcessType::Copy;
+        bool shouldCopy = getProcessType() >= CloneProcessType::Copy;
         
         if(shouldCopy)
         {
@@ -455,6 +544,83 @@ template <typename DataType, CloneProcessType ProcessType>
         }
 	}
 
+	template <int P> struct MultithreadedJob : public clone_worker_pool::Job
+	{
+		MultithreadedJob(clone_base& parent_, ProcessData<P>& original_, int numTasks_, int numClones_) :
+			parent(parent_),
+			original(original_),
+			numTasks(numTasks_),
+			numClones(numClones_)
+		{}
+
+		float* getSumBuffer(int taskIndex) const
+		{
+			return parent.taskBuffer.begin() + (taskIndex * 2 + 1) * P * original.getNumSamples();
+		}
+
+		void processTask(int taskIndex) override
+		{
+			auto numSamples = original.getNumSamples();
+			auto work = parent.taskBuffer.begin() + taskIndex * 2 * P * numSamples;
+			auto sum = getSumBuffer(taskIndex);
+
+			FloatVectorOperations::clear(sum, P * numSamples);
+
+			float* wPtr[P];
+
+			for (int c = 0; c < P; c++)
+				wPtr[c] = work + c * numSamples;
+
+			ProcessData<P> wd(wPtr, numSamples);
+			wd.copyNonAudioDataFrom(original);
+
+			auto firstClone = ActiveIterator(parent.cloneData).begin();
+			auto oPtr = original.getRawDataPointers();
+
+			for (int i = numClones * taskIndex / numTasks; i < numClones * (taskIndex + 1) / numTasks; i++)
+			{
+				for (int c = 0; c < P; c++)
+					FloatVectorOperations::copy(wPtr[c], oPtr[c], numSamples);
+
+				firstClone[i].process(wd);
+
+				FloatVectorOperations::add(sum, work, P * numSamples);
+			}
+		}
+
+		clone_base& parent;
+		ProcessData<P>& original;
+		const int numTasks;
+		const int numClones;
+	};
+
+	template <int P> void processMultithreaded(ProcessData<P>& d)
+	{
+		ActiveIterator it(cloneData);
+		auto numClones = (int)(it.end() - it.begin());
+		auto numTasks = jmin(numClones, numTaskSlots);
+		auto numSamples = d.getNumSamples();
+
+		if (numTasks < 2 || taskBuffer.size() < numTasks * 2 * P * numSamples)
+		{
+			processSplitFix(d);
+			return;
+		}
+
+		MultithreadedJob<P> job(*this, d, numTasks, numClones);
+		workerPool->run(job, numTasks);
+
+		auto dPtr = d.getRawDataPointers();
+
+		for (int c = 0; c < P; c++)
+		{
+			FloatVectorOperations::copy(dPtr[c], job.getSumBuffer(0) + c * numSamples, numSamples);
+
+			for (int t = 1; t < numTasks; t++)
+				FloatVectorOperations::add(dPtr[c], job.getSumBuffer(t) + c * numSamples, numSamples);
+		}
+	}
+
 	template <typename ProcessDataType> void process(ProcessDataType& d)
 	{
 		if (auto sl = SimpleReadWriteLock::ScopedTryReadLock(getCloneResizeLock()))
@@ -493,6 +659,29 @@ template <typename DataType, CloneProcessType ProcessType>
                     
                     break;
                 }
+                case CloneProcessType::Multithreaded:
+                {
+                    if constexpr (ProcessDataType::hasCompileTimeSize())
+                    {
+                        processMultithreaded(d);
+                    }
+                    else
+                    {
+                        switch (d.getNumChannels())
+                        {
+                        case 1: processMultithreaded(d.template as<ProcessData<1>>()); break;
+                        case 2: processMultithreaded(d.template as<ProcessData<2>>()); break;
+                        case 3: processMultithreaded(d.template as<ProcessData<3>>()); break;
+                        case 4: processMultithreaded(d.template as<ProcessData<4>>()); break;
+                        case 6: processMultithreaded(d.template as<ProcessData<6>>()); break;
+                        case 8: processMultithreaded(d.template as<ProcessData<8>>()); break;
+                        case 16: processMultithreaded(d.template as<ProcessData<16>>()); break;
+                        default: jassertfalse;
+                        }
+                    }
+
+                    break;
+                }
                 default: jassertfalse;
             }
 		}
@@ -528,7 +717,12 @@ template <typename DataType, CloneProcessType ProcessType>
 	
 	heap<float> workBuffer;
     heap<float> originalBuffer;
-	CloneProcessType processType;
+    heap<float> taskBuffer;
+	CloneProcessType processType = CloneProcessType::Serial;
+
+    SharedResourcePointer<clone_worker_pool> workerPool;
+    bool usesWorkerPool = false;
+    int numTaskSlots = 1;
 };
 
 }
@@ -686,9 +686,9 @@ private:
 
 struct oversample_base
 {
-	static constexpr int MaxOversamplingExponent = 4; // => 16x oversampling (2^4).
+	static constexpr int MaxOversamplingExponent = PolyphaseOversampler::MaxOversamplingExponent; // => 16x oversampling (2^4).
 
-	using Oversampler = juce::dsp::Oversampling<float>;
+	using Oversampler = PolyphaseOversampler;
 
 	using FilterType = Oversampler::FilterType;
 
@@ -710,7 +710,10 @@ struct oversample_base
 
         ScopedPointer<Oversampler> newOverSampler;
         
-        newOverSampler = new Oversampler(numChannels, (int)std::log2(oversamplingFactor), filterType, false);
+        // In a polyphonic context the filter state of every voice is kept in the oversampler
+        auto numVoices = polyHandler != nullptr ? NUM_POLYPHONIC_VOICES : 1;
+
+        newOverSampler = new Oversampler(numChannels, (int)std::log2(oversamplingFactor), filterType, numVoices);
 
         if (originalBlockSize > 0)
             newOverSampler->initProcessing(originalBlockSize);
@@ -724,11 +727,7 @@ struct oversample_base
 
 		originalSpecs = ps;
 
-		if (ps.voiceIndex != nullptr && ps.voiceIndex->isEnabled())
-		{
-			scriptnode::Error::throwError(Error::IllegalPolyphony);
-			return;
-		}
+		polyHandler = (ps.voiceIndex != nullptr && ps.voiceIndex->isEnabled()) ? ps.voiceIndex : nullptr;
         
         originalBlockSize = ps.blockSize;
         numChannels = ps.numChannels;
@@ -764,8 +763,8 @@ struct oversample_base
 	void setFilterType(int nt)
     {
 		span<FilterType, 2> types = {
-			FilterType::filterHalfBandPolyphaseIIR,
-			FilterType::filterHalfBandFIREquiripple
+			FilterType::PolyphaseIIR,
+			FilterType::PolyphaseFIR
 		};
 
 		auto newType = types[jlimit(0, 1, nt)];
@@ -791,7 +790,9 @@ protected:
     int originalBlockSize = 0;
     int numChannels = 0;
 
-	FilterType filterType = FilterType::filterHalfBandPolyphaseIIR;
+	FilterType filterType = FilterType::PolyphaseIIR;
+
+	PolyHandler* polyHandler = nullptr;
 
 	void* pObj = nullptr;
 	prototypes::prepare prepareFunc;
@@ -992,7 +993,14 @@ public:
 		hise::SimpleReadWriteLock::ScopedReadLock sl(this->lock);
 
 		if (oversampler != nullptr)
-			oversampler->reset();
+		{
+			auto voiceIndex = polyHandler != nullptr ? polyHandler->getVoiceIndex() : -1;
+
+			if (voiceIndex == -1)
+				oversampler->reset();
+			else
+				oversampler->resetVoice(voiceIndex);
+		}
 
 		obj.reset();
 	}
@@ -1015,6 +1023,9 @@ public:
 		if (oversampler == nullptr)
 			return;
 
+		if (polyHandler != nullptr)
+			oversampler->setVoiceIndex(PolyHandler::getVoiceIndexStatic(polyHandler));
+
 		auto bl = data.toAudioBlock();
 		auto output = oversampler->processSamplesUp(bl);
 
@@ -1858,6 +1869,9 @@ using clonesplit = clone_base<clone_data<T, options::yes, NumDuplicates>, CloneP
 template <typename T, int NumDuplicates>
 using clonecopy = clone_base<clone_data<T, options::yes, NumDuplicates>, CloneProcessType::Copy>;
 
+template <typename T, int NumDuplicates>
+using clonethreaded = clone_base<clone_data<T, options::yes, NumDuplicates>, CloneProcessType::Multithreaded>;
+
 template <typename T, int NumDuplicates>
 using fix_clonechain = clone_base<clone_data<T, options::no, NumDuplicates>, CloneProcessType::Serial>;
 
@@ -1867,6 +1881,9 @@ using fix_clonesplit = clone_base<clone_data<T, options::no, NumDuplicates>, Clo
 template <typename T, int NumDuplicates>
 using fix_clonecopy = clone_base<clone_data<T, options::no, NumDuplicates>, CloneProcessType::Copy>;
 
+template <typename T, int NumDuplicates>
+using fix_clonethreaded = clone_base<clone_data<T, options::no, NumDuplicates>, CloneProcessType::Multithreaded>;
+
 
 }
 
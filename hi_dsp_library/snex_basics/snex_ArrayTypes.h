@@ -40,6 +40,9 @@
 #if !JUCE_ARM
 #include <nmmintrin.h>
 #endif
+#if SNEX_USE_AVX
+#include <immintrin.h>
+#endif
 #include <stdint.h>
 
 
@@ -55,6 +58,9 @@ template <typename T> struct SpanOperators
 		static constexpr bool shouldLoadSource() { return true; }
 		static forcedinline void op(T& dst, const T& src) { dst += src; }
 		static forcedinline void vOp(__m128& dst, const __m128& src) { dst = _mm_add_ps(dst, src); }
+#if SNEX_USE_AVX
+		static forcedinline void vOp(__m256& dst, const __m256& src) { dst = _mm256_add_ps(dst, src); }
+#endif
 	};
 
 	struct multiply 
@@ -63,6 +69,9 @@ template <typename T> struct SpanOperators
 		static constexpr bool shouldLoadSource() { return true; }
 		static forcedinline void op(T& dst, const T& src) { dst *= src; } 
 		static forcedinline void vOp(__m128& dst, const __m128& src) { dst = _mm_mul_ps(dst, src); }
+#if SNEX_USE_AVX
+		static forcedinline void vOp(__m256& dst, const __m256& src) { dst = _mm256_mul_ps(dst, src); }
+#endif
 	};
 
 	struct assign 
@@ -71,6 +80,9 @@ template <typename T> struct SpanOperators
 		static constexpr bool shouldLoadSource() { return false; }
 		static forcedinline void op(T& dst, const T& src) { dst = src; } 
 		static forcedinline void vOp(__m128& dst, const __m128& src) { dst = src; }
+#if SNEX_USE_AVX
+		static forcedinline void vOp(__m256& dst, const __m256& src) { dst = src; }
+#endif
 	};
 	
 	struct divide 
@@ -79,6 +91,9 @@ template <typename T> struct SpanOperators
 		static constexpr bool shouldLoadSource() { return true; }
 		static forcedinline void op(T& dst, const T& src) { dst /= src; } 
 		static forcedinline void vOp(__m128& dst, const __m128& src) { dst = _mm_div_ps(dst, src); }
+#if SNEX_USE_AVX
+		static forcedinline void vOp(__m256& dst, const __m256& src) { dst = _mm256_div_ps(dst, src); }
+#endif
 	};
 
 	struct sub 
@@ -87,6 +102,9 @@ template <typename T> struct SpanOperators
 		static constexpr bool shouldLoadSource() { return true; }
 		static forcedinline void op(T& dst, const T& src) { dst -= src; } 
 		static forcedinline void vOp(__m128& dst, const __m128& src) { dst = _mm_sub_ps(dst, src); }
+#if SNEX_USE_AVX
+		static forcedinline void vOp(__m256& dst, const __m256& src) { dst = _mm256_sub_ps(dst, src); }
+#endif
 	};
 };
 
@@ -106,7 +124,7 @@ template <class T, int Size, int Alignment=16> struct span
 {
 	static constexpr ArrayID ArrayType = Types::ArrayID::SpanType;
 	using DataType = T;
-	using Type = span<T, Size>;
+	using Type = span<T, Size, Alignment>;
 
 	static constexpr int s = Size;
 
@@ -174,6 +192,30 @@ template <class T, int Size, int Alignment=16> struct span
 			// OperandType is a number
 			//static_assert(std::is_arithmetic<T>(), "not an arithmetic type");
 
+#if SNEX_USE_AVX
+			if constexpr (isAvxSimdable())
+			{
+				// We can use AVX instructions (8 floats at once)
+
+				static constexpr int numLoop = Size / 8;
+
+				auto ptr = (float*)data;
+				auto v = _mm256_set1_ps(op);
+
+				for (int i = 0; i < numLoop; i++)
+				{
+					__m256 dst;
+
+					if constexpr (OpType::shouldLoadSource())
+						dst = loadAvx(ptr);
+
+					OpType::vOp(dst, v);
+					storeAvx(ptr, dst);
+					ptr += 8;
+				}
+			}
+			else 
+#endif
 			if constexpr (isSimdable())
 			{
 				// We can use SSE instructions
@@ -231,6 +273,33 @@ template <class T, int Size, int Alignment=16> struct span
 			static constexpr int ThisSize = s;
 			static constexpr int OtherSize = OperandType::s;
 
+#if SNEX_USE_AVX
+			if constexpr (ThisSize == OtherSize && isAvxSimdable() && OperandType::isAvxSimdable())
+			{
+				// We can use AVX instructions for both spans
+
+				auto p1 = begin();
+				auto p2 = op.begin();
+
+				for (int i = 0; i < size(); i += 8)
+				{
+					__m256 dst;
+
+					if constexpr (OpType::shouldLoadSource())
+						dst = loadAvx(p1);
+
+					__m256 src = loadAvx(p2);
+
+					OpType::vOp(dst, src);
+
+					storeAvx(p1, dst);
+
+					p1 += 8;
+					p2 += 8;
+				}
+			}
+			else
+#endif
 			if constexpr (isSimdable() && OperandType::isSimdable())
 			{
 				// We can use SSE instructions for both spans
@@ -368,11 +437,26 @@ template <class T, int Size, int Alignment=16> struct span
 		return (std::is_same<T, float>() && Size % 4 == 0);
 	}
 
+	/** Returns true if the math operators of this span will use 8-wide AVX instructions. */
+	static constexpr bool isAvxSimdable()
+	{
+#if SNEX_USE_AVX
+		return (std::is_same<T, float>() && Size % 8 == 0);
+#else
+		return false;
+#endif
+	}
+
 	bool isAlignedTo16Byte() const
 	{
 		return isAlignedTo16Byte(*this);
 	}
 
+	bool isAlignedTo32Byte() const
+	{
+		return reinterpret_cast<uint64_t>(begin()) % 32 == 0;
+	}
+
 
 	template <class InterpolatorType> DataType interpolate(InterpolatorType& i) const
 	{
@@ -427,6 +511,21 @@ template <class T, int Size, int Alignment=16> struct span
 		return *reinterpret_cast<Type*>(this);
 	}
 
+	/** Converts this float span into a AVX span with 8 float elements at once. 
+	
+		The span must be aligned to 32 bytes (use span<float, Size, 32> or the float8 alias).
+	*/
+	span<span<float, 8, 32>, Size / 8, 32>& toSimd8()
+	{
+		using Type = span<span<float, 8, 32>, Size / 8, 32>;
+
+		static_assert(std::is_same<T, float>() && Size % 8 == 0, "is not SIMDable");
+		static_assert(Alignment % 32 == 0, "must be aligned to 32 bytes");
+		jassert(isAlignedTo32Byte());
+
+		return *reinterpret_cast<Type*>(this);
+	}
+
 	template<typename IndexType> typename std::enable_if<index::Helpers::canReturnReference<IndexType>(), const T&>::type
 		operator[](const IndexType& t) const
 	{
@@ -509,6 +608,13 @@ template <class T, int Size, int Alignment=16> struct span
 		return Alignment;
 	}
 
+#if SNEX_USE_AVX
+	// The AVX loads are unaligned because the default alignment of a span is 16 bytes.
+	// On all AVX capable CPUs the unaligned load has no penalty if the address is aligned anyway.
+	static forcedinline __m256 loadAvx(const float* ptr) { return _mm256_loadu_ps(ptr); }
+	static forcedinline void storeAvx(float* ptr, const __m256& v) { _mm256_storeu_ps(ptr, v); }
+#endif
+
 	alignas(alignment()) T data[Size];
 };
 
@@ -517,6 +623,9 @@ template <class T, int Size, int Alignment=16> struct span
 /** This alias is a special type on its own as it has mathematical operators that directly translate to SSE instructions. */
 using float4 = span<float, 4>;
 
+/** The 8-wide version of float4 that is aligned to 32 bytes. If SNEX_USE_AVX is enabled, the operators will use AVX instructions. */
+using float8 = span<float, 8, 32>;
+
 /** The dyn template class is an array that is only referencing memory that is owned by something else.
 	@ingroup snex_containers
  
@@ -582,6 +691,20 @@ template <class T> struct dyn
 		return rt;
 	}
 
+	/** Converts the data to a list of float8 elements. The data must be aligned to 32 bytes and the size must be a multiple of 8. */
+	dyn<float8> toSimd8() const
+	{
+		dyn<float8> rt;
+
+		jassert(this->size() % 8 == 0);
+		jassert(isSimdable8());
+
+		rt.data = reinterpret_cast<float8*>(begin());
+		rt.size_ = size() / 8;
+
+		return rt;
+	}
+
 	dyn<float>& asBlock()
 	{
 		static_assert(std::is_same<T, float>(), "not a float dyn");
@@ -734,6 +857,11 @@ template <class T> struct dyn
 		return reinterpret_cast<uint64_t>(begin()) % 16 == 0;
 	}
 
+	bool isSimdable8() const
+	{
+		return reinterpret_cast<uint64_t>(begin()) % 32 == 0;
+	}
+
 	bool isEmpty() const noexcept { return size() == 0; }
 
 	/** Returns the size of the array. Be aware that this is not a compile time constant. */
@@ -155,6 +155,12 @@ ExternalData::ExternalData(ComplexDataUIBase* b, int absoluteIndex) :
 	dataType(getDataTypeForClass(b)),
 	obj(b)
 {
+#if HISE_USE_COMPLEX_DATA_SNAPSHOTS
+	// core::table is the only node that reads the snapshots so far
+	if (dataType == DataType::Table)
+		b->setEnableSnapshotPublishing(true);
+#endif
+
 	SimpleReadWriteLock::ScopedReadLock sl(b->getDataLock());
 
 	switch (dataType)
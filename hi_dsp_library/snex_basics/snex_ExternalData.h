@@ -505,32 +505,29 @@ struct ExternalData
 			{
 				if (ed->isXYZ())
 				{
-					auto xyzData = static_cast<MultiChannelAudioBuffer::XYZItem*>(ed->data);
+					auto buffer = static_cast<MultiChannelAudioBuffer*>(ed->obj);
 
 					int n = (int)dataToFill->noteNumber;
 					int v = dataToFill->velocity;
 					int r = dataToFill->roundRobin;
 
-					for (int i = 0; i < ed->numSamples; i++)
+					if (auto item = buffer->findXYZItem(n, v, r))
 					{
-						if (xyzData[i].matches(n, v, r))
-						{
-							dataToFill->rootNote = (double)xyzData[i].root;
-
-							auto ptrs = xyzData[i].data->buffer.getArrayOfWritePointers();
-							auto nc = xyzData[i].data->buffer.getNumChannels();
-							auto ns = xyzData[i].data->buffer.getNumSamples();
+						dataToFill->rootNote = (double)item->root;
 
-							dataToFill->setLoopRange(xyzData[i].data->loopRange);
+						auto ptrs = item->data->buffer.getArrayOfWritePointers();
+						auto nc = item->data->buffer.getNumChannels();
+						auto ns = item->data->buffer.getNumSamples();
 
-							for (int c = 0; c < NumChannels; c++)
-							{
-								auto srcIndex = c * (nc > 1);
-								dataToFill->data[c].referToRawData(ptrs[srcIndex], ns);
-							}
+						dataToFill->setLoopRange(item->data->loopRange);
 
-							return 1;
+						for (int c = 0; c < NumChannels; c++)
+						{
+							auto srcIndex = c * (nc > 1);
+							dataToFill->data[c].referToRawData(ptrs[srcIndex], ns);
 						}
+
+						return 1;
 					}
 				}
 				else
@@ -909,6 +906,42 @@ struct DataWriteLock : hise::SimpleReadWriteLock::ScopedWriteLock
 	SimpleReadWriteLock dummy;
 };
 
+/** Pins the most recent snapshot of the external data for the lifetime of this object.
+    @ingroup snex_helpers
+
+	If the data object publishes snapshots (see ComplexDataUIBase::setEnableSnapshotPublishing()), 
+	this will never wait for a writer so you can use it on the audio thread while the data is being 
+	edited. If there is no snapshot it evaluates to false and you need to fall back to the DataReadLock:
+
+		if(auto s = DataSnapshotReader(this))
+			s.referBlockTo(b, 0);
+		else if(auto l = DataReadLock(this, true))
+			externalData.referBlockTo(b, 0);
+*/
+struct DataSnapshotReader : public ComplexDataUIBase::SnapshotPublisherType::ScopedReader
+{
+	DataSnapshotReader(data::base* d) :
+		DataSnapshotReader(d->externalData)
+	{}
+
+	DataSnapshotReader(const snex::ExternalData& d) :
+		ScopedReader(d.obj != nullptr ? d.obj->getSnapshotPublisher() : nullptr)
+	{}
+
+	/** Refers the block to the channel data of the pinned snapshot. */
+	void referBlockTo(block& b, int channelIndex) const
+	{
+		auto s = get();
+
+		if (s != nullptr && isPositiveAndBelow(channelIndex, s->buffer.getNumChannels()))
+			b.referToRawData(const_cast<float*>(s->buffer.getReadPointer(channelIndex)), s->buffer.getNumSamples());
+		else
+			b.referToNothing();
+	}
+
+	int getNumSamples() const { return get() != nullptr ? get()->buffer.getNumSamples() : 0; }
+};
+
 namespace data
 {
 
@@ -0,0 +1,161 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Commercial licenses for using HISE in an closed source project are
+*   available on request. Please visit the project's website to get more
+*   information about commercial licencing:
+*
+*   http://www.hartinstruments.net/hise/
+*
+*   HISE is based on the JUCE library,
+*   which also must be licenced for commercial applications:
+*
+*   http://www.juce.com
+*
+*   ===========================================================================
+*/
+
+
+namespace hise
+{
+
+using namespace juce;
+using namespace scriptnode;
+using namespace snex::Types;
+
+struct CloneProcessTypeTests : public juce::UnitTest
+{
+	CloneProcessTypeTests() :
+		UnitTest("Clone process type Tests", "Containers")
+	{}
+
+	static constexpr int NumClones = 32;
+	static constexpr int BlockSize = 512;
+
+	/** A clone with a heavy per-sample workload (a detuned saturated oscillator). */
+	struct heavy_clone
+	{
+		static constexpr int NumChannels = 2;
+		using WrappedObjectType = heavy_clone;
+
+		void prepare(PrepareSpecs) {}
+		void reset() { phase = 0.0f; }
+		void handleHiseEvent(HiseEvent&) {}
+		template <typename FrameDataType> void processFrame(FrameDataType&) {}
+
+		template <typename ProcessDataType> void process(ProcessDataType& d)
+		{
+			auto ptrs = d.getRawDataPointers();
+
+			for (int i = 0; i < d.getNumSamples(); i++)
+			{
+				phase += delta;
+
+				auto v = std::sin(phase);
+
+				for (int k = 0; k < 16; k++)
+					v = std::tanh(v * 1.1f);
+
+				for (int c = 0; c < NumChannels; c++)
+					ptrs[c][i] = ptrs[c][i] * 0.5f + v * 0.01f;
+			}
+		}
+
+		float phase = 0.0f;
+		float delta = 0.01f;
+	};
+
+	using CloneType = wrap::clone_base<wrap::clone_data<heavy_clone, 0, NumClones>, CloneProcessType::Dynamic>;
+
+	void runTest() override
+	{
+		beginTest("Multithreaded clones match the copy mode");
+
+		AudioSampleBuffer copyResult, threadedResult;
+
+		auto copyTime = render(CloneProcessType::Copy, copyResult);
+		auto threadedTime = render(CloneProcessType::Multithreaded, threadedResult);
+		auto serialTime = render(CloneProcessType::Serial, AudioSampleBuffer());
+
+		for (int c = 0; c < 2; c++)
+		{
+			for (int i = 0; i < copyResult.getNumSamples(); i++)
+			{
+				auto delta = std::abs(copyResult.getSample(c, i) - threadedResult.getSample(c, i));
+
+				if (delta > 1e-4f)
+				{
+					expect(false, "mismatch at sample " + String(i) + ": " + String(delta));
+					return;
+				}
+			}
+		}
+
+		logMessage("Rendering " + String(NumClones) + " clones: serial " + String(serialTime, 1) + "ms, copy "
+					+ String(copyTime, 1) + "ms, multithreaded " + String(threadedTime, 1) + "ms");
+	}
+
+	double render(CloneProcessType pt, AudioSampleBuffer&& result)
+	{
+		return render(pt, result);
+	}
+
+	double render(CloneProcessType pt, AudioSampleBuffer& result)
+	{
+		ScopedPointer<CloneType> clones = new CloneType();
+
+		int index = 0;
+
+		for (auto& c : CloneType::AllIterator(clones->cloneData))
+			c.delta = 0.01f + 0.0001f * (float)index++;
+
+		clones->setCloneProcessType((double)(int)pt);
+
+		PrepareSpecs ps;
+		ps.sampleRate = 44100.0;
+		ps.blockSize = BlockSize;
+		ps.numChannels = 2;
+
+		clones->prepare(ps);
+
+		constexpr int NumBlocks = 200;
+
+		result.setSize(2, BlockSize * NumBlocks);
+
+		Random r(123);
+
+		for (int c = 0; c < 2; c++)
+			for (int i = 0; i < result.getNumSamples(); i++)
+				result.setSample(c, i, r.nextFloat() * 0.2f - 0.1f);
+
+		auto start = Time::getMillisecondCounterHiRes();
+
+		for (int b = 0; b < NumBlocks; b++)
+		{
+			float* ptrs[2] = { result.getWritePointer(0, b * BlockSize), result.getWritePointer(1, b * BlockSize) };
+			ProcessData<2> d(ptrs, BlockSize);
+			clones->process(d);
+		}
+
+		return Time::getMillisecondCounterHiRes() - start;
+	}
+};
+
+static CloneProcessTypeTests cloneProcessTypeTests;
+
+} // namespace hise
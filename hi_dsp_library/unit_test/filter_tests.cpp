@@ -0,0 +1,128 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Commercial licenses for using HISE in an closed source project are
+*   available on request. Please visit the project's website to get more
+*   information about commercial licencing:
+*
+*   http://www.hartinstruments.net/hise/
+*
+*   HISE is based on the JUCE library,
+*   which also must be licenced for commercial applications:
+*
+*   http://www.juce.com
+*
+*   ===========================================================================
+*/
+
+
+namespace hise
+{
+
+using namespace juce;
+
+struct MultiChannelFilterTests : public juce::UnitTest
+{
+	MultiChannelFilterTests() :
+		UnitTest("MultiChannelFilter Tests", "Filters")
+	{}
+
+	static constexpr double SampleRate = 44100.0;
+	static constexpr int BlockSize = 512;
+
+	void runTest() override
+	{
+		for (int numChannels : { 1, 2, 3, 5 })
+		{
+			for (int mode : { StateVariableFilterSubType::LP, StateVariableFilterSubType::HP,
+							  StateVariableFilterSubType::BP, StateVariableFilterSubType::NOTCH })
+				testBlockMatchesFrames<StateVariableFilterSubType>(numChannels, mode);
+
+			testBlockMatchesFrames<LadderSubType>(numChannels, 0);
+			testBlockMatchesFrames<MoogFilterSubType>(numChannels, 0);
+		}
+	}
+
+private:
+
+	static void fillWithNoise(AudioSampleBuffer& b)
+	{
+		Random r(42);
+
+		for (int c = 0; c < b.getNumChannels(); c++)
+			for (int i = 0; i < b.getNumSamples(); i++)
+				b.setSample(c, i, r.nextFloat() * 2.0f - 1.0f);
+	}
+
+	/** The block processing uses the vectorised code path, so we compare it against the
+		per-frame processing with the same coefficients. */
+	template <typename SubType> void testBlockMatchesFrames(int numChannels, int mode)
+	{
+		beginTest(SubType::getStaticId().toString() + " mode " + String(mode) + ", " + String(numChannels) + " channels");
+
+		SubType blockFilter, frameFilter;
+
+		for (auto f : { &blockFilter, &frameFilter })
+		{
+			f->setType(mode);
+			f->reset(numChannels);
+			f->updateCoefficients(SampleRate, 2000.0, 4.0, 1.0);
+		}
+
+		AudioSampleBuffer blockData(numChannels, BlockSize);
+		fillWithNoise(blockData);
+
+		AudioSampleBuffer frameData;
+		frameData.makeCopyOf(blockData);
+
+		// process in two chunks to check that the state is written back correctly
+		blockFilter.processSamples(blockData, 0, BlockSize / 2);
+		blockFilter.processSamples(blockData, BlockSize / 2, BlockSize / 2);
+
+		float frame[NUM_MAX_CHANNELS];
+
+		for (int i = 0; i < BlockSize; i++)
+		{
+			for (int c = 0; c < numChannels; c++)
+				frame[c] = frameData.getSample(c, i);
+
+			frameFilter.processFrame(frame, numChannels);
+
+			for (int c = 0; c < numChannels; c++)
+				frameData.setSample(c, i, frame[c]);
+		}
+
+		for (int c = 0; c < numChannels; c++)
+		{
+			for (int i = 0; i < BlockSize; i++)
+			{
+				auto diff = std::abs(blockData.getSample(c, i) - frameData.getSample(c, i));
+
+				if (diff > 1e-4f)
+				{
+					expect(false, "mismatch at channel " + String(c) + ", sample " + String(i));
+					return;
+				}
+			}
+		}
+	}
+};
+
+static MultiChannelFilterTests multiChannelFilterTests;
+
+} // namespace hise
@@ -0,0 +1,197 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Commercial licenses for using HISE in an closed source project are
+*   available on request. Please visit the project's website to get more
+*   information about commercial licencing:
+*
+*   http://www.hartinstruments.net/hise/
+*
+*   HISE is based on the JUCE library,
+*   which also must be licenced for commercial applications:
+*
+*   http://www.juce.com
+*
+*   ===========================================================================
+*/
+
+
+namespace hise
+{
+
+using namespace juce;
+
+struct PolyphaseOversamplerTests : public juce::UnitTest
+{
+	PolyphaseOversamplerTests() :
+		UnitTest("PolyphaseOversampler Tests", "Filters")
+	{}
+
+	using FilterType = PolyphaseOversampler::FilterType;
+
+	static constexpr int BlockSize = 37;
+	static constexpr int NumBlocks = 64;
+
+	void runTest() override
+	{
+		for (auto t : { FilterType::PolyphaseIIR, FilterType::PolyphaseFIR })
+		{
+			for (int i = 0; i <= PolyphaseOversampler::MaxOversamplingExponent; i++)
+				testLatency(t, i);
+
+			testAliasRejection(t);
+			testVoiceState(t);
+		}
+	}
+
+private:
+
+	static String getName(FilterType t, int exponent)
+	{
+		String s;
+		s << (t == FilterType::PolyphaseFIR ? "FIR " : "IIR ") << String(1 << exponent) << "x";
+		return s;
+	}
+
+	/** Runs the signal through the up- and downsampling and returns the result. */
+	static AudioSampleBuffer process(PolyphaseOversampler& os, const AudioSampleBuffer& input)
+	{
+		AudioSampleBuffer output(input);
+
+		for (int i = 0; i < output.getNumSamples(); i += BlockSize)
+		{
+			auto numThisTime = jmin(BlockSize, output.getNumSamples() - i);
+			dsp::AudioBlock<float> block(output.getArrayOfWritePointers(), (size_t)output.getNumChannels(), (size_t)i, (size_t)numThisTime);
+
+			os.processSamplesUp(block);
+			os.processSamplesDown(block);
+		}
+
+		return output;
+	}
+
+	static AudioSampleBuffer createSine(double frequency, int numChannels, double delay=0.0)
+	{
+		AudioSampleBuffer b(numChannels, BlockSize * NumBlocks);
+
+		for (int c = 0; c < numChannels; c++)
+		{
+			for (int i = 0; i < b.getNumSamples(); i++)
+				b.setSample(c, i, (float)std::sin(2.0 * double_Pi * frequency * ((double)i - delay)));
+		}
+
+		return b;
+	}
+
+	void testLatency(FilterType t, int exponent)
+	{
+		beginTest("Latency " + getName(t, exponent));
+
+		PolyphaseOversampler os(2, exponent, t);
+		os.initProcessing(BlockSize);
+
+		expectEquals(os.getOversamplingFactor(), 1 << exponent, "wrong factor");
+
+		const double frequency = 0.01;
+		auto output = process(os, createSine(frequency, 2));
+		auto expected = createSine(frequency, 2, (double)os.getLatencyInSamples());
+
+		// skip the settling time of the filters
+		const int offset = 1000;
+
+		for (int c = 0; c < 2; c++)
+		{
+			auto maxError = 0.0f;
+
+			for (int i = offset; i < output.getNumSamples(); i++)
+				maxError = jmax(maxError, std::abs(output.getSample(c, i) - expected.getSample(c, i)));
+
+			expect(maxError < 0.001f, "latency mismatch: " + String(maxError));
+		}
+	}
+
+	void testAliasRejection(FilterType t)
+	{
+		beginTest("Alias rejection " + getName(t, 1));
+
+		PolyphaseOversampler os(1, 1, t);
+		os.initProcessing(BlockSize);
+
+		AudioSampleBuffer output(1, BlockSize * NumBlocks);
+		output.clear();
+
+		int phase = 0;
+
+		for (int i = 0; i < output.getNumSamples(); i += BlockSize)
+		{
+			dsp::AudioBlock<float> block(output.getArrayOfWritePointers(), 1, (size_t)i, (size_t)BlockSize);
+			auto up = os.processSamplesUp(block);
+
+			// Replace the oversampled signal with a tone above the original nyquist frequency
+			for (int j = 0; j < (int)up.getNumSamples(); j++)
+				up.getChannelPointer(0)[j] = (float)std::sin(2.0 * double_Pi * 0.4 * (double)phase++);
+
+			os.processSamplesDown(block);
+		}
+
+		auto magnitude = output.getMagnitude(0, 1000, output.getNumSamples() - 1000);
+		expect(Decibels::gainToDecibels(magnitude) < -70.0f, "alias rejection too low: " + String(Decibels::gainToDecibels(magnitude)) + "dB");
+	}
+
+	void testVoiceState(FilterType t)
+	{
+		beginTest("Voice state " + getName(t, 2));
+
+		const int numVoices = 4;
+		PolyphaseOversampler os(2, 2, t, numVoices);
+		os.initProcessing(BlockSize);
+
+		auto signal = createSine(0.05, 2);
+		AudioSampleBuffer silence(2, signal.getNumSamples());
+		silence.clear();
+
+		os.setVoiceIndex(0);
+		auto reference = process(os, signal);
+
+		os.setVoiceIndex(1);
+		auto silentOutput = process(os, silence);
+		expectEquals(silentOutput.getMagnitude(0, silentOutput.getNumSamples()), 0.0f, "voice state is not separated");
+
+		os.setVoiceIndex(2);
+		auto secondOutput = process(os, signal);
+
+		for (int i = 0; i < signal.getNumSamples(); i++)
+		{
+			if (secondOutput.getSample(0, i) != reference.getSample(0, i))
+			{
+				expect(false, "voice output mismatch at sample " + String(i));
+				break;
+			}
+		}
+
+		os.resetVoice(0);
+		os.setVoiceIndex(0);
+		auto afterReset = process(os, signal);
+
+		expectEquals(afterReset.getSample(0, 10), reference.getSample(0, 10), "voice reset doesn't clear the state");
+	}
+};
+
+static PolyphaseOversamplerTests polyphaseOversamplerTests;
+
+} // namespace hise
@@ -1186,6 +1186,333 @@ var HlacArchiver::readMetadataFromArchive(const File& sourceFile)
 	return var();
 }
 
+/** Decodes a temporary FLAC file into the HLAC monolith on a worker thread.
+
+	The decoded data is written into a sibling file which is moved to the target
+	location after the decoding succeeded, so an aborted extraction never leaves
+	a half written monolith in the target directory.
+*/
+struct HlacArchiver::DecodeJob : public ThreadPoolJob
+{
+	DecodeJob(ExtractionPipeline& p, const String& name_, const File& tmpFlacFile_, const File& targetFile_, int64 numBytes_);
+
+	~DecodeJob()
+	{
+		tmpFlacFile.deleteFile();
+	}
+
+	JobStatus runJob() override;
+
+private:
+
+	bool decode();
+
+	ExtractionPipeline& pipeline;
+	const String name;
+	const File tmpFlacFile;
+	const File targetFile;
+	const File partFile;
+	const int64 numBytes;
+};
+
+/** Runs the decoding jobs of extractSampleData() and collects their state.
+
+	All listener callbacks and progress updates are forwarded by update(), which is only
+	called from the extraction thread, so the listener never gets called from a worker thread.
+*/
+struct HlacArchiver::ExtractionPipeline
+{
+	ExtractionPipeline(HlacArchiver& parent_, const DecompressData& data_, int64 totalBytes_) :
+		parent(parent_),
+		data(data_),
+		totalBytes(jmax<int64>(1, totalBytes_)),
+		pool(data_.numThreads > 0 ? data_.numThreads : jmax(1, SystemStats::getNumCpus() - 1))
+	{}
+
+	~ExtractionPipeline()
+	{
+		abort = true;
+		pool.removeAllJobs(true, 10000);
+	}
+
+	/** Blocks until the pending jobs have freed up enough space for the given amount of compressed data. */
+	bool waitForCapacity(int64 numBytes)
+	{
+		while (pendingBytes.load() > 0 && pendingBytes.load() + numBytes > data.maxPendingBytes)
+		{
+			jobFinished.wait(50);
+
+			if (!update())
+				return false;
+		}
+
+		return update();
+	}
+
+	void addJob(const String& name, const File& tmpFlacFile, const File& targetFile, int64 numBytes)
+	{
+		readBytes += numBytes;
+		pendingBytes += numBytes;
+		pool.addJob(new DecodeJob(*this, name, tmpFlacFile, targetFile, numBytes), true);
+	}
+
+	void addSkippedBytes(int64 numBytes)
+	{
+		readBytes += numBytes;
+		decodedBytes += numBytes;
+	}
+
+	/** Forwards the log messages and the progress. Returns false if the extraction should stop. */
+	bool update()
+	{
+		Array<std::pair<bool, String>> messagesToSend;
+
+		{
+			ScopedLock sl(messageLock);
+			messagesToSend.swapWith(messages);
+		}
+
+		if (parent.listener != nullptr)
+		{
+			for (const auto& m : messagesToSend)
+			{
+				if (m.first)
+					parent.listener->logStatusMessage(m.second);
+				else
+					parent.listener->logVerboseMessage(m.second);
+			}
+		}
+
+		auto decoded = decodedBytes.load() + inFlightDecodedBytes.load();
+
+		if (data.progress != nullptr && readBytes > 0)
+			*data.progress = jlimit(0.0, 1.0, (double)decoded / (double)readBytes);
+
+		if (data.totalProgress != nullptr)
+			*data.totalProgress = jlimit(0.0, 1.0, (double)decoded / (double)totalBytes);
+
+		String error;
+
+		{
+			ScopedLock sl(messageLock);
+			error = errorMessage;
+		}
+
+		if (error.isNotEmpty())
+		{
+			if (parent.listener != nullptr && !errorReported)
+				parent.listener->criticalErrorOccured(error);
+
+			errorReported = true;
+			return false;
+		}
+
+		return !shouldExit();
+	}
+
+	/** Waits until all jobs are finished. */
+	bool finish()
+	{
+		while (pool.getNumJobs() > 0)
+		{
+			jobFinished.wait(50);
+
+			if (!update())
+				return false;
+		}
+
+		return update();
+	}
+
+	void log(const String& message, bool isStatus)
+	{
+		ScopedLock sl(messageLock);
+		messages.add({ isStatus, message });
+	}
+
+	void fail(const String& message)
+	{
+		{
+			ScopedLock sl(messageLock);
+
+			if (errorMessage.isEmpty())
+				errorMessage = message;
+		}
+
+		abort = true;
+	}
+
+	bool shouldExit() const
+	{
+		return abort.load() || parent.thread->threadShouldExit();
+	}
+
+	HlacArchiver& parent;
+	const DecompressData& data;
+	const int64 totalBytes;
+
+	int64 readBytes = 0;
+	bool errorReported = false;
+
+	CriticalSection messageLock;
+	Array<std::pair<bool, String>> messages;
+	String errorMessage;
+
+	std::atomic<bool> abort = { false };
+	std::atomic<int64> pendingBytes = { 0 };
+	std::atomic<int64> decodedBytes = { 0 };
+	std::atomic<int64> inFlightDecodedBytes = { 0 };
+
+	WaitableEvent jobFinished;
+
+	// must be the last member so that the jobs are stopped before the rest is destroyed
+	ThreadPool pool;
+};
+
+HlacArchiver::DecodeJob::DecodeJob(ExtractionPipeline& p, const String& name_, const File& tmpFlacFile_, const File& targetFile_, int64 numBytes_) :
+	ThreadPoolJob("Decode " + name_),
+	pipeline(p),
+	name(name_),
+	tmpFlacFile(tmpFlacFile_),
+	targetFile(targetFile_),
+	partFile(targetFile_.getSiblingFile(targetFile_.getFileName() + ".part")),
+	numBytes(numBytes_)
+{}
+
+ThreadPoolJob::JobStatus HlacArchiver::DecodeJob::runJob()
+{
+	auto ok = decode();
+
+	if (!ok)
+		partFile.deleteFile();
+
+	tmpFlacFile.deleteFile();
+
+	pipeline.pendingBytes -= numBytes;
+	pipeline.decodedBytes += numBytes;
+	pipeline.jobFinished.signal();
+
+	return jobHasFinished;
+}
+
+bool HlacArchiver::DecodeJob::decode()
+{
+	const auto& data = pipeline.data;
+
+	if (pipeline.shouldExit())
+		return false;
+
+	FlacAudioFormat flacFormat;
+	hlac::HiseLosslessAudioFormat hlacFormat;
+
+	FileInputStream* flacTempInputStream = new FileInputStream(tmpFlacFile);
+
+	jassert(flacTempInputStream->openedOk());
+
+	ScopedPointer<AudioFormatReader> flacReader = flacFormat.createReaderFor(flacTempInputStream, true);
+
+	if (flacReader == nullptr)
+	{
+		pipeline.fail("Can't read compressed data of " + name);
+		return false;
+	}
+
+	pipeline.log("    Samplerate: " + String(flacReader->sampleRate, 1), false);
+	pipeline.log("    Channels: " + String(flacReader->numChannels), false);
+	pipeline.log("    Length: " + String(flacReader->lengthInSamples), false);
+
+	ScopedPointer<AudioFormatWriter> writer;
+
+	if (!data.debugLogMode)
+	{
+		if (partFile.existsAsFile())
+			partFile.deleteFile();
+
+		StringPairArray metadata;
+
+		auto monolithOutputStream = new FileOutputStream(partFile);
+		writer = hlacFormat.createWriterFor(monolithOutputStream, flacReader->sampleRate, flacReader->numChannels, 5, metadata, 5);
+
+		if (writer == nullptr)
+		{
+			pipeline.fail("File write error for " + targetFile.getFileName());
+			return false;
+		}
+
+		hlac::HlacEncoder::CompressorOptions options = hlac::HlacEncoder::CompressorOptions::getPreset(hlac::HlacEncoder::CompressorOptions::Presets::Diff);
+
+		options.applyDithering = false;
+		options.normalisationMode = data.supportFullDynamics ? 2 : 0;
+
+		auto hlacWriter = dynamic_cast<HiseLosslessAudioFormatWriter*>(writer.get());
+		hlacWriter->preallocateMemory(flacReader->lengthInSamples, flacReader->numChannels);
+		hlacWriter->setOptions(options);
+	}
+
+	pipeline.log("Decompressing " + name, true);
+
+	const int bufferSize = 8192 * 32;
+
+	AudioSampleBuffer tempBuffer(flacReader->numChannels, data.debugLogMode ? 0 : bufferSize);
+
+	int64 reportedBytes = 0;
+
+	for (int64 readerOffset = 0; readerOffset < flacReader->lengthInSamples; readerOffset += bufferSize)
+	{
+		if (pipeline.shouldExit())
+		{
+			pipeline.inFlightDecodedBytes -= reportedBytes;
+			return false;
+		}
+
+		const int numToRead = jmin<int>(bufferSize, (int)(flacReader->lengthInSamples - readerOffset));
+
+		if (!data.debugLogMode)
+		{
+			flacReader->read(&tempBuffer, 0, numToRead, readerOffset, true, true);
+
+			if (!writer->writeFromAudioSampleBuffer(tempBuffer, 0, numToRead))
+			{
+				pipeline.inFlightDecodedBytes -= reportedBytes;
+				pipeline.fail("File write error for " + targetFile.getFileName());
+				return false;
+			}
+		}
+
+		auto progress = (double)(readerOffset + numToRead) / (double)flacReader->lengthInSamples;
+		auto newBytes = (int64)(progress * (double)numBytes);
+
+		pipeline.inFlightDecodedBytes += newBytes - reportedBytes;
+		reportedBytes = newBytes;
+	}
+
+	pipeline.inFlightDecodedBytes -= reportedBytes;
+
+	flacReader = nullptr;
+
+	if (data.debugLogMode)
+		return true;
+
+	if (!writer->flush())
+	{
+		pipeline.fail("File write error: Flushing file " + targetFile.getFileName());
+		return false;
+	}
+
+	writer = nullptr;
+
+	if (pipeline.shouldExit())
+		return false;
+
+	if (!partFile.moveFileTo(targetFile))
+	{
+		pipeline.fail("Can't move the decompressed file to " + targetFile.getFullPathName());
+		return false;
+	}
+
+	return true;
+}
+
 bool HlacArchiver::extractSampleData(const DecompressData& data)
 {
 	jassert(listener != nullptr);
@@ -1207,7 +1534,6 @@ bool HlacArchiver::extractSampleData(const DecompressData& data)
 
 	auto parts = getSourceFiles(sourceFile);
 	
-	int64 processedBytes = 0;
 	int64 totalBytes = 0;
 	
 	for (const auto& p : parts)
@@ -1215,19 +1541,16 @@ bool HlacArchiver::extractSampleData(const DecompressData& data)
 			
 	ScopedPointer<FileInputStream> fis = new FileInputStream(sourceFile);
 
-	FlacAudioFormat flacFormat;
-	hlac::HiseLosslessAudioFormat hlacFormat;
-
 	CHECK_FLAG(Flag::BeginMetadata);
 	auto metadataString = fis->readString();
 	CHECK_FLAG(Flag::EndMetadata);
 
 	VERBOSE_LOG(metadataString);
 
-	StringPairArray metadata;
-
 	int partIndex = 1;
 
+	ExtractionPipeline pipeline(*this, data, totalBytes);
+
 	currentFlag = readFlag(fis);
 
 	if (currentFlag == Flag::BeginHeaderFile)
@@ -1276,7 +1599,7 @@ bool HlacArchiver::extractSampleData(const DecompressData& data)
 		auto archiveTime = Time::fromISO8601(fis->readString());
 		CHECK_FLAG(Flag::EndTime);
 
-		if (thread->threadShouldExit())
+		if (!pipeline.update())
 			return false;
 
 		
@@ -1304,7 +1627,14 @@ bool HlacArchiver::extractSampleData(const DecompressData& data)
 		{
 			VERBOSE_LOG("  Overwriting File ");
 
-			bool ok = true;
+			CHECK_FLAG(Flag::BeginMonolithLength);
+			auto bytesToRead = fis->readInt64();
+			CHECK_FLAG(Flag::EndMonolithLength);
+
+			// wait until the decoder threads have caught up before writing the next temp file
+			// (the monolith might be split, so we'll wait again for each part with the total size)
+			if (!pipeline.waitForCapacity(bytesToRead))
+				return false;
 
 			File tmpFlacFile = targetHlacFile.getSiblingFile("TmpFlac.flac").getNonexistentSibling();
 
@@ -1313,19 +1643,13 @@ bool HlacArchiver::extractSampleData(const DecompressData& data)
 
 			ScopedPointer<FileOutputStream> flacTempWriteStream = new FileOutputStream(tmpFlacFile);
 
-			CHECK_FLAG(Flag::BeginMonolithLength);
-			auto bytesToRead = fis->readInt64();
-			CHECK_FLAG(Flag::EndMonolithLength);
-
 			STATUS_LOG("Creating temp file");
 
 			CHECK_FLAG(Flag::BeginMonolith);
 
 			int64 monolithBytes = 0;
 			
-			const int64 written = flacTempWriteStream->writeFromInputStream(*fis, bytesToRead);
-			processedBytes += written;
-			monolithBytes += written;
+			monolithBytes += flacTempWriteStream->writeFromInputStream(*fis, bytesToRead);
 
 			currentFlag = readFlag(fis);
 
@@ -1345,7 +1669,7 @@ bool HlacArchiver::extractSampleData(const DecompressData& data)
 					if (continuingFromDataOnlyPart)
 					{
 						VERBOSE_LOG("  No further part found, leaving " + name + " untouched");
-						return true;
+						return pipeline.finish();
 					}
 
 					listener->criticalErrorOccured("Missing archive part: " + nextPart.getFileName());
@@ -1362,110 +1686,33 @@ bool HlacArchiver::extractSampleData(const DecompressData& data)
 
 				CHECK_FLAG(Flag::ResumeMonolith);
 
-				const int64 written = flacTempWriteStream->writeFromInputStream(*fis, bytesToRead);
-				processedBytes += written;
-				monolithBytes += written;
+				// This is the same amount that will be added to the pending bytes with addJob()
+				if (!pipeline.waitForCapacity(monolithBytes + bytesToRead))
+				{
+					flacTempWriteStream = nullptr;
+					tmpFlacFile.deleteFile();
+					return false;
+				}
+
+				monolithBytes += flacTempWriteStream->writeFromInputStream(*fis, bytesToRead);
 
 				currentFlag = readFlag(fis);
 			}
 
 			if (thread->threadShouldExit())
+			{
+				flacTempWriteStream = nullptr;
+				tmpFlacFile.deleteFile();
 				return false;
+			}
 
 			jassert(currentFlag == Flag::EndMonolith);
 
 			flacTempWriteStream->flush();
 			flacTempWriteStream = nullptr;
 
-			FileInputStream* flacTempInputStream = new FileInputStream(tmpFlacFile);
-
-			jassert(flacTempInputStream->openedOk());
-
-			ScopedPointer<AudioFormatReader> flacReader = flacFormat.createReaderFor(flacTempInputStream, true);
-
-			if (flacReader == nullptr)
-				return false;
-
-			VERBOSE_LOG("    Samplerate: " + String(flacReader->sampleRate, 1));
-			VERBOSE_LOG("    Channels: " + String(flacReader->numChannels));
-			VERBOSE_LOG("    Length: " + String(flacReader->lengthInSamples));
-
-			FileOutputStream* monolithOutputStream; 
-			ScopedPointer<AudioFormatWriter> writer;
-
-			if (!data.debugLogMode)
-			{
-				if (targetHlacFile.existsAsFile())
-					targetHlacFile.deleteFile();
-
-				monolithOutputStream = new FileOutputStream(targetHlacFile);
-				writer = hlacFormat.createWriterFor(monolithOutputStream, flacReader->sampleRate, flacReader->numChannels, 5, metadata, 5);
-			}
-
-			STATUS_LOG("Decompressing " + name);
-
-			const int bufferSize = 8192 * 32;
-
-			hlac::HlacEncoder::CompressorOptions options = hlac::HlacEncoder::CompressorOptions::getPreset(hlac::HlacEncoder::CompressorOptions::Presets::Diff);
-
-			if (thread->threadShouldExit())
-				return false;
-
-			options.applyDithering = false;
-			options.normalisationMode = data.supportFullDynamics ? 2 : 0;
-
-			//dynamic_cast<HiseLosslessAudioFormatWriter*>(writer.get())->setTemporaryBufferType(true);
-
-			dynamic_cast<HiseLosslessAudioFormatWriter*>(writer.get())->preallocateMemory(flacReader->lengthInSamples, flacReader->numChannels);
+			pipeline.addJob(name, tmpFlacFile, targetHlacFile, monolithBytes);
 
-			if(!data.debugLogMode)
-				dynamic_cast<HiseLosslessAudioFormatWriter*>(writer.get())->setOptions(options);
-
-			AudioSampleBuffer tempBuffer(flacReader->numChannels, data.debugLogMode ? 0 : bufferSize);
-
-			const int64 processedBytesAtMonolithStart = processedBytes - monolithBytes;
-
-			for (int64 readerOffset = 0; readerOffset < flacReader->lengthInSamples; readerOffset += bufferSize)
-			{
-				if (thread->threadShouldExit())
-					return false;
-
-				const int numToRead = jmin<int>(bufferSize, (int)(flacReader->lengthInSamples - readerOffset));
-
-				if (!data.debugLogMode)
-				{
-					flacReader->read(&tempBuffer, 0, numToRead, readerOffset, true, true);
-					ok = writer->writeFromAudioSampleBuffer(tempBuffer, 0, numToRead);
-					if (!ok)
-					{
-						listener->criticalErrorOccured("File write error for " + targetHlacFile.getFileName());
-						return false;
-					}
-				}
-
-				*data.progress = (double)readerOffset / (double)flacReader->lengthInSamples;
-				
-				const int64 tempBytes = processedBytesAtMonolithStart + (int64)(monolithBytes * (*data.progress));
-				*data.totalProgress = (double)tempBytes / (double)totalBytes;
-			}
-			
-			if (!data.debugLogMode)
-			{
-				ok = writer->flush();
-				if (!ok)
-				{
-					listener->criticalErrorOccured("File write error: Flushing file " + targetHlacFile.getFileName());
-					return false;
-				}
-
-				if (thread->threadShouldExit())
-					return false;
-
-				writer = nullptr;
-			}
-
-			flacReader = nullptr;
-			tmpFlacFile.deleteFile();
 			currentFlag = readFlag(fis);
 		}
 		else
@@ -1478,6 +1725,7 @@ bool HlacArchiver::extractSampleData(const DecompressData& data)
 
 			CHECK_FLAG(Flag::BeginMonolith);
 			fis->skipNextBytes(bytesToSkip);
+			pipeline.addSkippedBytes(bytesToSkip);
 			currentFlag = readFlag(fis);
 
 			while (currentFlag == Flag::SplitMonolith)
@@ -1493,7 +1741,7 @@ bool HlacArchiver::extractSampleData(const DecompressData& data)
 					if (continuingFromDataOnlyPart)
 					{
 						VERBOSE_LOG("  No further part found, stopping here");
-						return true;
+						return pipeline.finish();
 					}
 
 					listener->criticalErrorOccured("Missing archive part: " + nextPart.getFileName());
@@ -1512,6 +1760,7 @@ bool HlacArchiver::extractSampleData(const DecompressData& data)
 
 				CHECK_FLAG(Flag::ResumeMonolith);
 				fis->skipNextBytes(bytesToSkip);
+				pipeline.addSkippedBytes(bytesToSkip);
 
 				currentFlag = readFlag(fis);
 			}
@@ -1523,6 +1772,9 @@ bool HlacArchiver::extractSampleData(const DecompressData& data)
 
 	jassert(currentFlag == Flag::EndOfArchive);
 
+	if (!pipeline.finish())
+		return false;
+
 	*data.totalProgress = 1.0;
 
 	return true;
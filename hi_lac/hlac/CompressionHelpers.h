@@ -417,6 +417,11 @@ struct HlacArchiver
 		double* totalProgress = nullptr;
 		bool debugLogMode = false;
 
+		/** The number of threads that decode the monoliths in parallel (-1 uses all cores but one). */
+		int numThreads = -1;
+
+		/** The maximum amount of compressed data that can wait in temp files for being decoded. */
+		int64 maxPendingBytes = (int64)1024 * 1024 * 1024;
 	};
 
 	HlacArchiver(Thread* threadToUse) :
@@ -434,7 +439,13 @@ struct HlacArchiver
 		virtual void criticalErrorOccured(const String& message) = 0;
 	};
 
-	/** Extracts the compressed data from the given file. */
+	/** Extracts the compressed data from the given file.
+
+		The archive is read sequentially on the given thread, which copies the compressed data of
+		each monolith into a temp file. The temp files are then decoded and written to the target
+		directory by a pool of worker threads, so that the reading and the decoding of multiple
+		monoliths can happen at the same time.
+	*/
 	bool extractSampleData(const DecompressData& data);
 
     static String getArchiveCoreName(const File& archivePart)
@@ -474,6 +485,9 @@ struct HlacArchiver
 
 private:
 
+	struct DecodeJob;
+	struct ExtractionPipeline;
+
 	FileInputStream* writeTempFile(AudioFormatReader* reader, int bitDepth=16);
 
 	Listener* listener = nullptr;
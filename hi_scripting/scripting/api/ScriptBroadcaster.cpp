@@ -3213,6 +3213,7 @@ struct ScriptBroadcaster::Wrapper
 	API_VOID_METHOD_WRAPPER_3(ScriptBroadcaster, callWithDelay);
 	API_VOID_METHOD_WRAPPER_1(ScriptBroadcaster, setReplaceThisReference);
 	API_VOID_METHOD_WRAPPER_1(ScriptBroadcaster, setEnableQueue);
+	API_VOID_METHOD_WRAPPER_1(ScriptBroadcaster, setEnableCoalescing);
     API_VOID_METHOD_WRAPPER_1(ScriptBroadcaster, setRealtimeMode);
 	API_VOID_METHOD_WRAPPER_3(ScriptBroadcaster, setBypassed);
 	API_VOID_METHOD_WRAPPER_0(ScriptBroadcaster, refreshContextMenuState);
@@ -3261,6 +3262,7 @@ ScriptBroadcaster::ScriptBroadcaster(ProcessorWithScriptingContent* p, const var
 	ADD_API_METHOD_3(callWithDelay);
 	ADD_API_METHOD_1(setReplaceThisReference);
 	ADD_API_METHOD_1(setEnableQueue);
+	ADD_API_METHOD_1(setEnableCoalescing);
     ADD_API_METHOD_1(setRealtimeMode);
 	ADD_API_METHOD_1(resendLastMessage);
 	ADD_API_METHOD_3(setBypassed);
@@ -3698,9 +3700,16 @@ void ScriptBroadcaster::sendMessageInternal(var args, bool isSync)
     
 	Array<var> newValues;
 
+	// undefined arguments keep the value of the pending message
+	auto mergeIntoPending = enableCoalescing.load() && asyncPending.load() && !enableQueue;
+
 	for (int i = 0; i < defaultValues.size(); i++)
 	{
 		auto v = BroadcasterHelpers::getArg(args, i);
+
+		if (mergeIntoPending && v.isUndefined())
+			v = lastValues[i];
+
 		somethingChanged |= lastValues[i] != v;
 		newValues.add(v);
 	}
@@ -3760,6 +3769,9 @@ void ScriptBroadcaster::sendMessageInternal(var args, bool isSync)
 
 					auto r = safeThis->sendInternal(arrayToUse);
 
+					if (safeThis->enableCoalescing)
+						++safeThis->numDeliveredMessages;
+
 					safeThis->asyncPending.store(false);
 					return r;
 				};
@@ -3772,6 +3784,11 @@ void ScriptBroadcaster::sendMessageInternal(var args, bool isSync)
 					dynamic_cast<JavascriptProcessor*>(getScriptProcessor()),
 					f);
 			}
+			else if (enableCoalescing)
+			{
+				// the pending message will pick up the new values
+				++numDroppedMessages;
+			}
 		}
 	}
 }
@@ -4466,6 +4483,17 @@ void ScriptBroadcaster::setEnableQueue(bool shouldUseQueue)
 	enableQueue = shouldUseQueue;
 }
 
+void ScriptBroadcaster::setEnableCoalescing(bool shouldCoalesceMessages)
+{
+	if (shouldCoalesceMessages != enableCoalescing.load())
+	{
+		enableCoalescing.store(shouldCoalesceMessages);
+		numDeliveredMessages.store(0);
+		numDroppedMessages.store(0);
+		coalescingBroadcaster.sendMessage(sendNotificationAsync, shouldCoalesceMessages);
+	}
+}
+
 void ScriptBroadcaster::setBypassed(bool shouldBeBypassed, bool sendMessageIfEnabled, bool async)
 {
 	if (shouldBeBypassed != bypassed)
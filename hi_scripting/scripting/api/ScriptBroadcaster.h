@@ -223,6 +223,9 @@ struct ScriptBroadcaster :  public ConstScriptingObject,
 	/** If this is enabled, the broadcaster will keep an internal queue of all messages and will guarantee to send them all. */
 	void setEnableQueue(bool shouldUseQueue);
 
+	/** If this is enabled, asynchronous messages that arrive while a message is pending will be merged into it (the last value wins for each argument, undefined arguments keep the pending value). This has no effect if the queue is enabled. */
+	void setEnableCoalescing(bool shouldCoalesceMessages);
+
 	/** Deactivates the broadcaster so that it will not send messages. If sendMessageIfEnabled is true, it will send the last value when unbypassed. */
 	void setBypassed(bool shouldBeBypassed, bool sendMessageIfEnabled, bool async);
 
@@ -290,6 +293,11 @@ private:
 
 	std::atomic<bool> asyncPending = { false };
 
+	std::atomic<bool> enableCoalescing = { false };
+
+	std::atomic<int> numDeliveredMessages = { 0 };
+	std::atomic<int> numDroppedMessages = { 0 };
+
 	void handleDebugStuff();
 
 	var pendingData;
@@ -343,6 +351,9 @@ private:
 
 	LambdaBroadcaster<ItemBase*, String> errorBroadcaster;
 
+	/** Sends a message when the coalescing mode is changed so that the broadcaster map can show the counters. */
+	LambdaBroadcaster<bool> coalescingBroadcaster;
+
 	struct TargetBase: public ItemBase
 	{
 		TargetBase(const var& obj_, const var& f, const var& metadata_);;
@@ -55,6 +55,7 @@ struct ScriptUserPresetHandler::Wrapper
 	API_VOID_METHOD_WRAPPER_1(ScriptUserPresetHandler, updateSaveInPresetComponents);
 	API_VOID_METHOD_WRAPPER_0(ScriptUserPresetHandler, updateConnectedComponentsFromModuleState);
 	API_VOID_METHOD_WRAPPER_1(ScriptUserPresetHandler, setUseUndoForPresetLoading);
+	API_VOID_METHOD_WRAPPER_1(ScriptUserPresetHandler, setUseDifferentialLoading);
 	API_METHOD_WRAPPER_0(ScriptUserPresetHandler, createObjectForSaveInPresetComponents);
 	API_VOID_METHOD_WRAPPER_0(ScriptUserPresetHandler, resetToDefaultUserPreset);
 	API_METHOD_WRAPPER_0(ScriptUserPresetHandler, createObjectForAutomationValues);
@@ -105,6 +106,7 @@ ScriptUserPresetHandler::ScriptUserPresetHandler(ProcessorWithScriptingContent*
 	ADD_API_METHOD_1(updateSaveInPresetComponents);
 	ADD_API_METHOD_0(updateConnectedComponentsFromModuleState);
 	ADD_API_METHOD_1(setUseUndoForPresetLoading);
+	ADD_API_METHOD_1(setUseDifferentialLoading);
 	ADD_API_METHOD_0(createObjectForSaveInPresetComponents);
 	ADD_API_METHOD_0(createObjectForAutomationValues);
 	ADD_API_METHOD_0(getSecondsSinceLastPresetLoad);
@@ -211,6 +213,11 @@ void ScriptUserPresetHandler::setUseUndoForPresetLoading(bool shouldUseUndoManag
 	getMainController()->getUserPresetHandler().setAllowUndoAtUserPresetLoad(shouldUseUndoManager);
 }
 
+void ScriptUserPresetHandler::setUseDifferentialLoading(bool shouldUseDifferentialLoading)
+{
+	getMainController()->getUserPresetHandler().setUseDifferentialLoading(shouldUseDifferentialLoading);
+}
+
 void ScriptUserPresetHandler::setPreCallback(var presetCallback)
 {
 	preCallback = WeakCallbackHolder(getScriptProcessor(), this, presetCallback, 1);
@@ -61,6 +61,9 @@ public:
 	/** Enables Engine.undo() to restore the previous user preset (default is disabled). */
 	void setUseUndoForPresetLoading(bool shouldUseUndoManager);
 
+	/** Only restores the controls and module states that differ from the current state and skips the voice kill if only plain control values have changed. */
+	void setUseDifferentialLoading(bool shouldUseDifferentialLoading);
+
 	/** Sets a callback that will be executed synchronously before the preset was loaded*/
 	void setPreCallback(var presetPreCallback);
 
@@ -2460,13 +2460,17 @@ var ScriptingApi::Engine::createFFT()
 
 int ScriptingApi::Engine::getLatencySamples() const
 {
-	return dynamic_cast<const AudioProcessor*>(getScriptProcessor()->getMainController_())->getLatencySamples();
+	auto mc = getScriptProcessor()->getMainController_();
+	return dynamic_cast<const AudioProcessor*>(mc)->getLatencySamples() - mc->getOversamplingLatency();
 }
 
 void ScriptingApi::Engine::setLatencySamples(int latency)
 {
-	auto ap = dynamic_cast<AudioProcessor*>(getScriptProcessor()->getMainController_());
-	ap->setLatencySamples(latency);
+	auto mc = getScriptProcessor()->getMainController_();
+	auto ap = dynamic_cast<AudioProcessor*>(mc);
+
+	// the latency of the global oversampling is always added
+	ap->setLatencySamples(latency + mc->getOversamplingLatency());
 }
 
 int ScriptingApi::Engine::getMidiNoteFromName(String midiNoteName) const
@@ -2783,6 +2787,7 @@ struct ScriptingApi::Settings::Wrapper
 	API_VOID_METHOD_WRAPPER_1(Settings, setEnableDebugMode);
 	API_VOID_METHOD_WRAPPER_0(Settings, startPerfettoTracing);
 	API_VOID_METHOD_WRAPPER_1(Settings, stopPerfettoTracing);
+	API_VOID_METHOD_WRAPPER_1(Settings, dumpLightweightTrace);
 	API_VOID_METHOD_WRAPPER_0(Settings, crashAndBurn);
 };
 
@@ -2830,6 +2835,7 @@ ScriptingApi::Settings::Settings(ProcessorWithScriptingContent* s) :
 	ADD_API_METHOD_1(setSampleFolder);
 	ADD_API_METHOD_0(startPerfettoTracing);
 	ADD_API_METHOD_1(stopPerfettoTracing);
+	ADD_API_METHOD_1(dumpLightweightTrace);
 	ADD_API_METHOD_0(crashAndBurn);
 }
 
@@ -2914,6 +2920,26 @@ void ScriptingApi::Settings::stopPerfettoTracing(var traceFileToUse)
 #endif
 }
 
+void ScriptingApi::Settings::dumpLightweightTrace(var traceFileToUse)
+{
+#if HISE_INCLUDE_LIGHTWEIGHT_TRACER && !HISE_INCLUDE_PROFILING_TOOLKIT
+	if(auto sf = dynamic_cast<ScriptingObjects::ScriptFile*>(traceFileToUse.getObject()))
+	{
+		auto r = LightweightTracer::getInstance().writeChromeTrace(sf->f);
+
+		if(!r.wasOk())
+			reportScriptError(r.getErrorMessage());
+	}
+	else
+	{
+		reportScriptError("Not a valid file supplied");
+	}
+#else
+	ignoreUnused(traceFileToUse);
+	reportScriptError("The lightweight tracer is not enabled, make sure to compile your project / HISE with HISE_INCLUDE_LIGHTWEIGHT_TRACER=1");
+#endif
+}
+
 void ScriptingApi::Settings::crashAndBurn()
 {
 #if USE_BACKEND
@@ -3852,6 +3878,7 @@ struct ScriptingApi::Sampler::Wrapper
 	API_METHOD_WRAPPER_0(Sampler, getNumSelectedSounds);
 	API_VOID_METHOD_WRAPPER_2(Sampler, setSoundPropertyForSelection);
 	API_VOID_METHOD_WRAPPER_2(Sampler, setSoundPropertyForAllSamples);
+	API_VOID_METHOD_WRAPPER_2(Sampler, setSoundProperties);
 	API_METHOD_WRAPPER_2(Sampler, getSoundProperty);
 	API_VOID_METHOD_WRAPPER_3(Sampler, setSoundProperty);
 	API_VOID_METHOD_WRAPPER_2(Sampler, purgeMicPosition);
@@ -3917,6 +3944,7 @@ sampler(sampler_)
 	ADD_API_METHOD_0(getNumSelectedSounds);
 	ADD_API_METHOD_2(setSoundPropertyForSelection);
 	ADD_API_METHOD_2(setSoundPropertyForAllSamples);
+	ADD_API_METHOD_2(setSoundProperties);
 	ADD_API_METHOD_2(getSoundProperty);
 	ADD_API_METHOD_3(setSoundProperty);
 	ADD_API_METHOD_2(purgeMicPosition);
@@ -4419,16 +4447,20 @@ void ScriptingApi::Sampler::setSoundPropertyForSelection(int propertyId, var new
 	auto& sounds = soundSelection.getItemArray();
 	auto id = sampleIds[propertyId];
 
-	auto f = [sounds, id, newValue](Processor* /*p*/)
+	auto f = [sounds, id, newValue](Processor* p)
 	{
+		SampleMap::PropertyTransaction t(*static_cast<ModulatorSampler*>(p)->getSampleMap());
+
 		const int numSelected = sounds.size();
 
 		for (int i = 0; i < numSelected; i++)
 		{
 			if (sounds[i].get() != nullptr)
-				sounds[i]->setSampleProperty(id, newValue, false);
+				t.set(sounds[i].get(), id, newValue);
 		}
 
+		t.apply(false);
+
 		return SafeFunctionCall::OK;
 	};
 
@@ -4453,10 +4485,14 @@ void ScriptingApi::Sampler::setSoundPropertyForAllSamples(int propertyIndex, var
 	{
 		auto s = static_cast<ModulatorSampler*>(p);
 
+		SampleMap::PropertyTransaction t(*s->getSampleMap());
+
 		ModulatorSampler::SoundIterator iter(s);
 
 		while (auto sound = iter.getNextSound())
-			sound->setSampleProperty(id, newValue, false);
+			t.set(sound.get(), id, newValue);
+
+		t.apply(false);
 
 		return SafeFunctionCall::OK;
 	};
@@ -4464,6 +4500,56 @@ void ScriptingApi::Sampler::setSoundPropertyForAllSamples(int propertyIndex, var
 	s->callAsyncIfJobsPending(f);
 }
 
+void ScriptingApi::Sampler::setSoundProperties(var soundList, var propertyData)
+{
+	WARN_IF_AUDIO_THREAD(true, ScriptGuard::IllegalApiCall);
+
+	ModulatorSampler *s = static_cast<ModulatorSampler*>(sampler.get());
+
+	if (s == nullptr)
+	{
+		reportScriptError("setSoundProperties() only works with Samplers.");
+		RETURN_VOID_IF_NO_THROW()
+	}
+
+	auto list = soundList.getArray();
+
+	if (list == nullptr)
+	{
+		reportScriptError("soundList must be an array of samples");
+		RETURN_VOID_IF_NO_THROW()
+	}
+
+	if (propertyData.isArray() && propertyData.size() != list->size())
+	{
+		reportScriptError("propertyData must have the same size as the soundList");
+		RETURN_VOID_IF_NO_THROW()
+	}
+
+	SampleMap::PropertyTransaction t(*s->getSampleMap());
+
+	for (int i = 0; i < list->size(); i++)
+	{
+		auto ss = dynamic_cast<ScriptingObjects::ScriptingSamplerSound*>(list->getUnchecked(i).getObject());
+
+		if (ss == nullptr)
+		{
+			reportScriptError("Illegal sample at index " + String(i));
+			RETURN_VOID_IF_NO_THROW()
+		}
+
+		auto values = propertyData.isArray() ? propertyData[i] : propertyData;
+
+		if (auto dyn = values.getDynamicObject())
+		{
+			for (const auto& prop : dyn->getProperties())
+				t.set(ss->getSoundPtr().get(), prop.name, prop.value);
+		}
+	}
+
+	t.apply(false);
+}
+
 var ScriptingApi::Sampler::getSoundProperty(int propertyIndex, int soundIndex)
 {
 	WARN_IF_AUDIO_THREAD(true, ScriptGuard::IllegalApiCall);
@@ -870,6 +870,9 @@ public:
 		/** Stops the perfetto profile recording and dumps the data to the given file. */
 		void stopPerfettoTracing(var traceFileToUse);
 
+		/** Writes the records of the lightweight tracer to the given file (Chrome trace JSON format). */
+		void dumpLightweightTrace(var traceFileToUse);
+
 		/** Calls abort to terminate the program. You can use this to check your crash reporting workflow. */
 		void crashAndBurn();
 
@@ -952,6 +955,9 @@ public:
 		/** Sets the property for all samples of the sampler. */
 		void setSoundPropertyForAllSamples(int propertyIndex, var newValue);
 
+		/** Sets multiple properties of a list of sounds in a single batch. Pass either one JSON object for all sounds or an array with one object per sound. */
+		void setSoundProperties(var soundList, var propertyData);
+
 		/** Returns the property of the sound with the specified index. */
 		var getSoundProperty(int propertyIndex, int soundIndex);
 
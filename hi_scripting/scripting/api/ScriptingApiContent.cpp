@@ -8361,12 +8361,111 @@ void ScriptingApi::Content::restoreAllControlsFromPreset(const String &fileName)
 
 void ScriptingApi::Content::restoreAllControlsFromPreset(const ValueTree &preset)
 {
-	restoreFromValueTree(preset);
+	restoreControlsFromPresetInternal(preset, nullptr);
+}
+
+void ScriptingApi::Content::restoreControlsFromPreset(const ValueTree &preset, const Array<int>& componentIndexes)
+{
+	restoreControlsFromPresetInternal(preset, &componentIndexes);
+}
+
+Array<int> ScriptingApi::Content::getChangedComponentsInPreset(const ValueTree& preset, bool& onlyPlainValues) const
+{
+	static const Identifier id_("id");
+	static const Identifier type_("type");
+	static const Identifier value_("value");
+
+	Array<int> changedComponents;
+	onlyPlainValues = true;
+
+	for (int i = 0; i < components.size(); i++)
+	{
+		auto c = components[i].get();
+
+		if (!c->getScriptObjectProperty(ScriptComponent::Properties::saveInPreset)) continue;
+
+		auto allowStrings = dynamic_cast<ScriptLabel*>(c) != nullptr;
+		auto isPlainComponent = !allowStrings && dynamic_cast<ScriptSliderPack*>(c) == nullptr;
+
+		auto presetChild = preset.getChildWithProperty(id_, c->getName().toString());
+
+		if (!presetChild.isValid())
+		{
+			// The component will be reset to its default value
+			changedComponents.add(i);
+			onlyPlainValues &= isPlainComponent;
+			continue;
+		}
+
+		auto newValue = Helpers::getCleanedComponentValue(presetChild.getProperty(value_), allowStrings);
+		auto currentValue = c->getValue();
+
+		bool valueChanged;
+
+		if (newValue.isObject() || newValue.isString() || currentValue.isObject() || currentValue.isString())
+			valueChanged = JSON::toString(newValue, true) != JSON::toString(currentValue, true);
+		else
+			valueChanged = (float)newValue != (float)currentValue;
+
+		// Check the additional properties (eg. the range of a slider or the data of a table)
+		auto currentState = c->exportAsValueTree();
+		bool dataChanged = false;
+
+		auto checkProperties = [&](const ValueTree& a, const ValueTree& b)
+		{
+			for (int j = 0; j < a.getNumProperties(); j++)
+			{
+				auto pId = a.getPropertyName(j);
+
+				if (pId == id_ || pId == type_ || pId == value_)
+					continue;
+
+				if (a.getProperty(pId).toString() != b.getProperty(pId).toString())
+					dataChanged = true;
+			}
+		};
+
+		checkProperties(presetChild, currentState);
+		checkProperties(currentState, presetChild);
+
+		if (valueChanged || dataChanged)
+		{
+			changedComponents.add(i);
+			onlyPlainValues &= isPlainComponent && !dataChanged && !newValue.isObject() && !newValue.isString();
+		}
+	}
+
+	return changedComponents;
+}
+
+void ScriptingApi::Content::restoreControlsFromPresetInternal(const ValueTree& preset, const Array<int>* componentIndexes)
+{
+	if (componentIndexes == nullptr)
+		restoreFromValueTree(preset);
+	else
+	{
+		static const Identifier id_("id");
+
+		for (auto i : *componentIndexes)
+		{
+			if (auto c = components[i].get())
+			{
+				auto child = preset.getChildWithProperty(id_, c->getName().toString());
+
+				if (!child.isValid())
+					c->resetValueToDefault();
+				else if (child.getProperty("type").toString().isNotEmpty())
+					c->restoreFromValueTree(child);
+			}
+		}
+	}
 
 	auto macroNames = getMacroNames();
 
 	for (int i = 0; i < components.size(); i++)
 	{
+		if (componentIndexes != nullptr && !componentIndexes->contains(i)) continue;
+
 		if (!components[i]->getScriptObjectProperty(ScriptComponent::Properties::saveInPreset)) continue;
 
 
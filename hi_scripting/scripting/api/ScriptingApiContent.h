@@ -3209,6 +3209,16 @@ public:
 	// Restores the content and sets the attributes so that the macros and the control callbacks gets executed.
 	void restoreAllControlsFromPreset(const ValueTree &preset);
 
+	// Same as restoreAllControlsFromPreset, but only restores the components with the given indexes.
+	void restoreControlsFromPreset(const ValueTree &preset, const Array<int>& componentIndexes);
+
+	/** Compares the preset with the current component values and returns the indexes of all components that need to be restored.
+
+		onlyPlainValues will be set to false if one of the changed components stores more than a plain number (eg. a label text,
+		the data of a slider pack or a table), so that the caller knows that it can't restore it like a simple parameter change.
+	*/
+	Array<int> getChangedComponentsInPreset(const ValueTree& preset, bool& onlyPlainValues) const;
+
 	Colour getColour() const { return colour; };
 	void endInitialization();
 
@@ -3572,6 +3582,8 @@ private:
 
 	static void initNumberProperties();
 
+	void restoreControlsFromPresetInternal(const ValueTree& preset, const Array<int>* componentIndexes);
+
     bool isRebuilding = false;
     
 	UpdateDispatcher updateDispatcher;
@@ -2603,11 +2603,12 @@ void ScriptingObjects::ScriptingSamplerSound::setFromJSON(var object)
 
 	if (auto dyn = object.getDynamicObject())
 	{
+		SampleMap::PropertyTransaction t(*getSampler()->getSampleMap());
+
 		for (auto prop : dyn->getProperties())
-		{
-			// TODO: maybe defer the update until everything is set ?
-			sound->setSampleProperty(prop.name, prop.value);
-		}
+			t.set(sound.get(), prop.name, prop.value);
+
+		t.apply(true);
 	}
 }
 
@@ -11117,6 +11118,8 @@ struct ScriptingObjects::ScriptingComplexGroupManager::Wrapper
 	API_VOID_METHOD_WRAPPER_3(ScriptingComplexGroupManager, addGroupEventStartOffset);
 	API_VOID_METHOD_WRAPPER_3(ScriptingComplexGroupManager, fadeOutGroupEvent);
 	API_VOID_METHOD_WRAPPER_3(ScriptingComplexGroupManager, setGroupVolume);
+	API_VOID_METHOD_WRAPPER_1(ScriptingComplexGroupManager, setPrefetchOptions);
+	API_METHOD_WRAPPER_0(ScriptingComplexGroupManager, getPrefetchStatistics);
 };
 
 ScriptingObjects::ScriptingComplexGroupManager::ScriptingComplexGroupManager(ProcessorWithScriptingContent* pwsc, ModulatorSampler* sampler_) :
@@ -11142,6 +11145,8 @@ ScriptingObjects::ScriptingComplexGroupManager::ScriptingComplexGroupManager(Pro
 	ADD_API_METHOD_3(addGroupEventStartOffset);
 	ADD_API_METHOD_3(fadeOutGroupEvent);
 	ADD_API_METHOD_3(setGroupVolume);
+	ADD_API_METHOD_1(setPrefetchOptions);
+	ADD_API_METHOD_0(getPrefetchStatistics);
 }
 
 void ScriptingObjects::ScriptingComplexGroupManager::setLayerProperty(var layerIdOrIndex, String propertyId, var value)
@@ -11395,6 +11400,38 @@ void ScriptingObjects::ScriptingComplexGroupManager::setGroupVolume(int layerInd
 	}
 }
 
+void ScriptingObjects::ScriptingComplexGroupManager::setPrefetchOptions(var options)
+{
+	if (auto gm = getManager())
+	{
+		ComplexGroupManager::PrefetchOptions o;
+		o.enabled = (bool)options.getProperty("Enabled", true);
+		o.memoryBudget = (int64)((double)options.getProperty("MemoryBudget", 0.0) * 1024.0 * 1024.0);
+		o.numPredictions = (int)options.getProperty("NumPredictions", 2);
+
+		gm->setPrefetchOptions(o);
+	}
+}
+
+var ScriptingObjects::ScriptingComplexGroupManager::getPrefetchStatistics() const
+{
+	if (auto gm = getManager())
+	{
+		auto stats = gm->getPrefetchStatistics();
+
+		DynamicObject::Ptr obj = new DynamicObject();
+		obj->setProperty("NumHits", stats.numHits);
+		obj->setProperty("NumMisses", stats.numMisses);
+		obj->setProperty("NumLoads", stats.numLoads);
+		obj->setProperty("NumEvictions", stats.numEvictions);
+		obj->setProperty("MemoryUsage", (double)stats.memoryUsage / 1024.0 / 1024.0);
+
+		return var(obj.get());
+	}
+
+	return {};
+}
+
 hise::ComplexGroupManager* ScriptingObjects::ScriptingComplexGroupManager::getManager() const
 {
 	if (sampler == nullptr)
@@ -3379,6 +3379,12 @@ namespace ScriptingObjects
 		/** Sets the smoothed volume for the given layer / group. */
 		void setGroupVolume(int layerIndex, int groupIndex, double gainFactor);
 
+		/** Enables the predictive prefetching of purgable layers with a JSON object { Enabled, MemoryBudget (in MB), NumPredictions }. */
+		void setPrefetchOptions(var options);
+
+		/** Returns the hit / miss counters and the memory usage (in MB) of the prefetcher. */
+		var getPrefetchStatistics() const;
+
 		// ================================================================================ API Methods
 
 	private:
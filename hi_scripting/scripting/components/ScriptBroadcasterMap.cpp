@@ -272,6 +272,13 @@ void ScriptBroadcasterMap::rebuild()
 		{
 			m.ok |= !e.isEmpty();
 		});
+
+		// rebuild so that the coalescing counters are added or removed
+		br->coalescingBroadcaster.removeListener(*this);
+		br->coalescingBroadcaster.addListener(*this, [](ScriptBroadcasterMap& m, bool)
+		{
+			m.triggerAsyncUpdate();
+		}, false);
 	}
 	
 	for (auto b : allBroadcasters)
@@ -188,6 +188,22 @@ struct ScriptBroadcasterMap::BroadcasterEntry : public ScriptBroadcasterMap::Ent
 			}));
 		}
 
+		if (sb->enableCoalescing.load())
+		{
+			addChildWithPreferredSize(new LiveUpdateVarBody(updater, "coalesced", [weakSb]()
+			{
+				if (weakSb != nullptr)
+				{
+					String s;
+					s << String(weakSb->numDeliveredMessages.load()) << " sent, ";
+					s << String(weakSb->numDroppedMessages.load()) << " dropped";
+					return var(s);
+				}
+
+				return var();
+			}));
+		}
+
         menubar.setName(b->metadata.id.toString());
 		menubar.setFactory(new ScriptBroadcasterMapFactory());
 
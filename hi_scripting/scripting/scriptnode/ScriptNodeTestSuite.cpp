@@ -1035,6 +1035,92 @@ struct ScriptNodeTests : public juce::UnitTest
 
 static ScriptNodeTests snt;
 
+#if USE_BACKEND && HISE_INCLUDE_SNEX
+struct FrozenNetworkTests : public juce::UnitTest
+{
+	FrozenNetworkTests() :
+		UnitTest("Frozen network tests")
+	{};
+
+	static void fillWithRamp(AudioSampleBuffer& b)
+	{
+		for (int c = 0; c < b.getNumChannels(); c++)
+		{
+			for (int i = 0; i < b.getNumSamples(); i++)
+				b.setSample(c, i, (float)i / (float)b.getNumSamples() - 0.5f * (float)c);
+		}
+	}
+
+	static void process(DspNetwork* n, AudioSampleBuffer& b)
+	{
+		ProcessDataDyn d(b.getArrayOfWritePointers(), b.getNumSamples(), b.getNumChannels());
+		n->process(d);
+	}
+
+	void runTest() override
+	{
+		ScopedValueSetter<bool> svs(MainController::unitTestMode, true);
+
+		beginTest("Testing frozen network output against the node tree");
+
+		constexpr int NumSamples = 512;
+
+		ScopedPointer<BackendProcessor> bp = new BackendProcessor(nullptr, nullptr);
+		ScopedPointer<JavascriptMasterEffect> fx = new JavascriptMasterEffect(bp, "FreezeTest");
+
+		auto network = fx->getOrCreate("freeze_test");
+		var root(network->getRootNode());
+
+		auto mul = dynamic_cast<NodeBase*>(network->createAndAdd("math.mul", "mul1", root).getObject());
+		auto add = dynamic_cast<NodeBase*>(network->createAndAdd("math.add", "add1", root).getObject());
+
+		expect(mul != nullptr && add != nullptr, "nodes created");
+
+		if (mul == nullptr || add == nullptr)
+			return;
+
+		mul->getParameterFromIndex(0)->setValueSync(0.5);
+		add->getParameterFromIndex(0)->setValueSync(0.25);
+
+		network->setNumChannels(2);
+		network->prepareToPlay(44100.0, NumSamples);
+
+		AudioSampleBuffer interpreted(2, NumSamples);
+		AudioSampleBuffer frozen(2, NumSamples);
+
+		fillWithRamp(interpreted);
+		fillWithRamp(frozen);
+
+		process(network, interpreted);
+
+		// 0 * 0.5 + 0.25
+		expectWithinAbsoluteError(interpreted.getSample(0, 0), 0.25f, 1e-6f, "node tree processed");
+
+		expect(network->freezeToJit(true), "freeze the network");
+		expect(network->isFrozenToJit(), "network is frozen");
+
+		process(network, frozen);
+
+		for (int c = 0; c < 2; c++)
+		{
+			for (int i = 0; i < NumSamples; i++)
+			{
+				expectWithinAbsoluteError(frozen.getSample(c, i), interpreted.getSample(c, i), 1e-6f,
+					"channel " + String(c) + ", sample " + String(i));
+			}
+		}
+
+		network->freezeToJit(false);
+		expect(!network->isFrozenToJit(), "network is unfrozen");
+
+		fx = nullptr;
+		bp = nullptr;
+	}
+};
+
+static FrozenNetworkTests fnt;
+#endif
+
 }
 
 #endif
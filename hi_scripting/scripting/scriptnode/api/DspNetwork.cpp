@@ -45,6 +45,7 @@ struct DspNetwork::Wrapper
 	API_METHOD_WRAPPER_1(DspNetwork, get);
 	API_METHOD_WRAPPER_1(DspNetwork, createTest);
 	API_VOID_METHOD_WRAPPER_1(DspNetwork, setForwardControlsToParameters);
+	API_METHOD_WRAPPER_1(DspNetwork, freezeToJit);
 	API_METHOD_WRAPPER_1(DspNetwork, setParameterDataFromJSON);
 	API_METHOD_WRAPPER_3(DspNetwork, createAndAdd);
 	API_METHOD_WRAPPER_2(DspNetwork, createFromJSON);
@@ -154,7 +155,12 @@ DspNetwork::DspNetwork(hise::ProcessorWithScriptingContent* p, ValueTree data_,
 
 	localCableManager = new routing::local_cable_base::Manager(this);
 
-	setRootNode(createFromValueTree(true, data.getChild(0), true));
+	{
+#if HISE_INCLUDE_SNEX
+		CodeManager::ScopedParallelCompilation spc(codeManager);
+#endif
+		setRootNode(createFromValueTree(true, data.getChild(0), true));
+	}
 	networkParameterHandler.root = getRootNode();
 
 	initialId = getId();
@@ -167,6 +173,7 @@ DspNetwork::DspNetwork(hise::ProcessorWithScriptingContent* p, ValueTree data_,
 	ADD_API_METHOD_3(createAndAdd);
 	ADD_API_METHOD_1(get);
 	ADD_API_METHOD_1(setForwardControlsToParameters);
+	ADD_API_METHOD_1(freezeToJit);
 	ADD_API_METHOD_1(setParameterDataFromJSON);
 	ADD_API_METHOD_1(createTest);
 	ADD_API_METHOD_2(clear);
@@ -243,6 +250,11 @@ DspNetwork::~DspNetwork()
 	stopTimer();
 
 	lastInjector = var();
+
+#if HISE_INCLUDE_SNEX
+	frozenNode = nullptr;
+#endif
+
 	root = nullptr;
 	selectionUpdater = nullptr;
 	nodes.clear();
@@ -693,10 +705,28 @@ void DspNetwork::reset()
 
 	if (auto rn = getRootNode())
 		rn->reset();
+
+#if HISE_INCLUDE_SNEX
+	if (frozenNode != nullptr)
+		frozenNode->reset();
+#endif
 }
 
 void DspNetwork::handleHiseEvent(HiseEvent& e)
 {
+#if HISE_INCLUDE_SNEX
+	if (frozenNode != nullptr)
+	{
+		if (auto s = SimpleReadWriteLock::ScopedTryReadLock(getConnectionLock()))
+		{
+			if (frozenNode != nullptr)
+				frozenNode->handleHiseEvent(e);
+		}
+
+		return;
+	}
+#endif
+
 	getRootNode()->handleHiseEvent(e);
 }
 
@@ -716,6 +746,14 @@ void DspNetwork::process(ProcessDataDyn& data)
 
 	if (auto s = SimpleReadWriteLock::ScopedTryReadLock(getConnectionLock()))
 	{
+#if HISE_INCLUDE_SNEX
+		if (frozenNode != nullptr)
+		{
+			frozenNode->process(data);
+			return;
+		}
+#endif
+
 		if (exceptionHandler.isOk())
 			getRootNode()->process(data);
 	}
@@ -748,6 +786,52 @@ void DspNetwork::setForwardControlsToParameters(bool shouldForward)
 	forwardControls = shouldForward;
 }
 
+bool DspNetwork::freezeToJit(bool shouldBeFrozen)
+{
+#if HISE_INCLUDE_SNEX
+	ScopedPointer<FrozenJitNode> newNode;
+
+	if (shouldBeFrozen)
+	{
+		newNode = new FrozenJitNode(*this);
+
+		auto r = newNode->compile();
+
+		if (r.failed())
+		{
+			debugToConsole(dynamic_cast<Processor*>(getScriptProcessor()), "Can't freeze " + getId() + ": " + r.getErrorMessage());
+			return false;
+		}
+
+		if (isInitialised())
+			newNode->prepare(currentSpecs);
+	}
+
+	ScopedPointer<FrozenJitNode> oldNode;
+
+	{
+		SimpleReadWriteLock::ScopedWriteLock sl(getConnectionLock());
+		oldNode = frozenNode.release();
+		frozenNode = newNode.release();
+	}
+
+	return true;
+#else
+	ignoreUnused(shouldBeFrozen);
+	reportScriptError("SNEX is disabled");
+	return false;
+#endif
+}
+
+bool DspNetwork::isFrozenToJit() const
+{
+#if HISE_INCLUDE_SNEX
+	return frozenNode != nullptr;
+#else
+	return false;
+#endif
+}
+
 void DspNetwork::prepareToPlay(double sampleRate, double blockSize)
 {
 	runPostInitFunctions();
@@ -776,6 +860,11 @@ void DspNetwork::prepareToPlay(double sampleRate, double blockSize)
 				runPostInitFunctions();
 				getRootNode()->reset();
 			}
+
+#if HISE_INCLUDE_SNEX
+			if (frozenNode != nullptr)
+				frozenNode->prepare(currentSpecs);
+#endif
             
             initialised = true;
 		}
@@ -2031,6 +2120,138 @@ void DspNetwork::SelectionUpdater::changeListenerCallback(ChangeBroadcaster*)
 
 
 #if HISE_INCLUDE_SNEX
+DspNetwork::FrozenJitNode::FrozenJitNode(DspNetwork& parent_):
+	parent(parent_)
+{
+	scope.setPolyphonic(parent.isPolyphonic());
+}
+
+Result DspNetwork::FrozenJitNode::compile()
+{
+	auto rootTree = parent.getValueTree().getChildWithName(PropertyIds::Node);
+
+	if (!rootTree.isValid() || parent.getRootNode() == nullptr)
+		return Result::fail("No root node");
+
+	auto numChannels = snex::cppgen::ValueTreeBuilder::getRootChannelAmount(rootTree);
+
+	snex::cppgen::ValueTreeBuilder builder(rootTree, snex::cppgen::ValueTreeBuilder::Format::JitCompiledInstance);
+	builder.setOutputFormat(snex::cppgen::ValueTreeBuilder::Format::JitCompiledInstance);
+
+	auto br = builder.createCppCode();
+
+	if (br.r.failed())
+		return br.r;
+
+	snex::jit::Compiler::Ptr compiler = new snex::jit::Compiler(scope);
+
+	node = new snex::jit::JitCompiledNode(*compiler, br.code, rootTree[PropertyIds::ID].toString(), numChannels);
+
+	if (node->r.failed())
+		return node->r;
+
+	auto numRootParameters = parent.getRootNode()->getNumParameters();
+
+	if (node->getNumParameters() != numRootParameters)
+		return Result::fail("Parameter mismatch: " + String(node->getNumParameters()) + " compiled parameters, " + String(numRootParameters) + " root parameters");
+
+	// Same index scheme as OpaqueNode::initExternalData()
+	auto holder = parent.getExternalDataHolder();
+	int totalIndex = 0;
+	auto ok = Result::ok();
+
+	ExternalData::forEachType([&](ExternalData::DataType t)
+	{
+		auto numRequired = node->getNumRequiredDataObjects(t);
+
+		if (numRequired > 0 && holder == nullptr)
+		{
+			ok = Result::fail("The network requires external data");
+			return;
+		}
+
+		for (int i = 0; i < numRequired; i++)
+			node->setExternalData(holder->getData(t, i), totalIndex++);
+	});
+
+	if (ok.failed())
+		return ok;
+
+	// NaN forces the initial update of every parameter
+	lastValues.insertMultiple(0, std::numeric_limits<double>::quiet_NaN(), numRootParameters);
+
+	return Result::ok();
+}
+
+void DspNetwork::FrozenJitNode::prepare(PrepareSpecs ps)
+{
+	auto rn = parent.getRootNode();
+	auto& eh = parent.getExceptionHandler();
+	auto wasMismatch = channelMismatch;
+
+	channelMismatch = ps.numChannels < node->getNumChannels();
+
+	if (channelMismatch)
+	{
+		Error e;
+		e.error = Error::ChannelMismatch;
+		e.expected = node->getNumChannels();
+		e.actual = ps.numChannels;
+		eh.addError(rn, e, "The frozen network needs " + String(e.expected) + " channels");
+		return;
+	}
+
+	if (wasMismatch)
+		eh.removeError(rn, Error::ChannelMismatch);
+
+	ps.numChannels = node->getNumChannels();
+	node->prepare(ps);
+	updateParameters();
+}
+
+void DspNetwork::FrozenJitNode::process(ProcessDataDyn& d)
+{
+	// prepare() reports the channel mismatch to the exception handler
+	if (channelMismatch || d.getNumChannels() < node->getNumChannels())
+	{
+		jassert(channelMismatch);
+		return;
+	}
+
+	updateParameters();
+	node->process(d);
+}
+
+void DspNetwork::FrozenJitNode::handleHiseEvent(HiseEvent& e)
+{
+	node->handleHiseEvent(e);
+}
+
+void DspNetwork::FrozenJitNode::reset()
+{
+	node->reset();
+}
+
+void DspNetwork::FrozenJitNode::updateParameters()
+{
+	auto rn = parent.getRootNode();
+
+	for (int i = 0; i < lastValues.size(); i++)
+	{
+		if (auto p = rn->getParameterFromIndex(i))
+		{
+			auto v = p->getValue();
+
+			// NaN != NaN, so this also catches the initial update
+			if (v != lastValues[i])
+			{
+				lastValues.set(i, v);
+				node->setParameterDynamic(i, v);
+			}
+		}
+	}
+}
+
 juce::File DspNetwork::CodeManager::getCodeFolder() const
 {
 	File f = parent.getScriptProcessor()->getMainController_()->getCurrentFileHandler().getSubDirectory(FileHandlerBase::DspNetworks).getChildFile("CodeLibrary");
@@ -2044,6 +2265,72 @@ DspNetwork::CodeManager::CodeManager(DspNetwork& p):
 			
 }
 
+DspNetwork::CodeManager::ScopedParallelCompilation::ScopedParallelCompilation(CodeManager& m):
+	manager(m),
+	wasDeferring(m.deferCompilations)
+{
+	manager.deferCompilations = true;
+}
+
+DspNetwork::CodeManager::ScopedParallelCompilation::~ScopedParallelCompilation()
+{
+	manager.deferCompilations = wasDeferring;
+
+	if (!wasDeferring)
+		manager.compilePendingWorkbenches();
+}
+
+bool DspNetwork::CodeManager::deferCompilation(snex::ui::WorkbenchData* wb)
+{
+	if (!deferCompilations)
+		return false;
+
+	pendingCompilations.addIfNotAlreadyThere(wb);
+	return true;
+}
+
+void DspNetwork::CodeManager::compilePendingWorkbenches()
+{
+	ReferenceCountedArray<snex::ui::WorkbenchData> list;
+	list.swapWith(pendingCompilations);
+
+	if (list.isEmpty())
+		return;
+
+	std::atomic<int> nextIndex = { 0 };
+
+	auto compileNext = [&list, &nextIndex]()
+	{
+		for (int i = nextIndex++; i < list.size(); i = nextIndex++)
+			list[i]->handleCompilation();
+	};
+
+	struct Worker : public Thread
+	{
+		Worker(const std::function<void()>& f_) :
+			Thread("SNEX Parallel Compile Thread", HISE_DEFAULT_STACK_SIZE),
+			f(f_)
+		{}
+
+		void run() override { f(); }
+
+		std::function<void()> f;
+	};
+
+	auto numWorkers = jmin(list.size(), SystemStats::getNumCpus()) - 1;
+
+	OwnedArray<Worker> workers;
+
+	for (int i = 0; i < numWorkers; i++)
+		workers.add(new Worker(compileNext))->startThread();
+
+	// The calling thread compiles too and then waits for the others
+	compileNext();
+
+	for (auto w : workers)
+		w->waitForThreadToExit(-1);
+}
+
 DspNetwork::CodeManager::SnexSourceCompileHandler::SnexCompileListener::~SnexCompileListener()
 {}
 
@@ -2116,9 +2403,9 @@ snex::ui::WorkbenchData::Ptr DspNetwork::CodeManager::getOrCreate(const Identifi
 	auto ef = parent.getMainController()->getExternalScriptFile(targetFile, false);
 
 	if(ef != nullptr)
-		return entries.add(new Entry(typeId, ef, parent.getScriptProcessor()))->wb;
+		return entries.add(new Entry(*this, typeId, ef, parent.getScriptProcessor()))->wb;
 	else
-		return entries.add(new Entry(typeId, targetFile, parent.getScriptProcessor()))->wb;
+		return entries.add(new Entry(*this, typeId, targetFile, parent.getScriptProcessor()))->wb;
 	
 }
 
@@ -2151,7 +2438,7 @@ StringArray DspNetwork::CodeManager::getClassList(const Identifier& id, const St
 	return sa;
 }
 
-DspNetwork::CodeManager::Entry::Entry(const Identifier& t, const File& targetFile, ProcessorWithScriptingContent* sp):
+DspNetwork::CodeManager::Entry::Entry(CodeManager& m, const Identifier& t, const File& targetFile, ProcessorWithScriptingContent* sp):
 	type(t),
 	parameterFile(targetFile.withFileExtension("xml")),
 	resourceType(ExternalScriptFile::ResourceType::FileBased)
@@ -2163,7 +2450,7 @@ DspNetwork::CodeManager::Entry::Entry(const Identifier& t, const File& targetFil
 	if (auto xml = XmlDocument::parse(parameterFile))
 		pTree = ValueTree::fromXml(*xml);
 	
-	init(new snex::ui::WorkbenchData::DefaultCodeProvider(wb.get(), targetFile), pTree, sp);
+	init(m, new snex::ui::WorkbenchData::DefaultCodeProvider(wb.get(), targetFile), pTree, sp);
 }
 
 struct EmbeddedSnippetCodeProvider: public snex::ui::WorkbenchData::CodeProvider
@@ -2192,7 +2479,7 @@ struct EmbeddedSnippetCodeProvider: public snex::ui::WorkbenchData::CodeProvider
 	ExternalScriptFile::Ptr ef;
 };
 
-DspNetwork::CodeManager::Entry::Entry(const Identifier& t, const ExternalScriptFile::Ptr& embeddedFile, 
+DspNetwork::CodeManager::Entry::Entry(CodeManager& m, const Identifier& t, const ExternalScriptFile::Ptr& embeddedFile, 
 	ProcessorWithScriptingContent* sp):
 	type(t),
     resourceType(ExternalScriptFile::ResourceType::EmbeddedInSnippet)
@@ -2204,7 +2491,7 @@ DspNetwork::CodeManager::Entry::Entry(const Identifier& t, const ExternalScriptF
 	if(auto xml = XmlDocument::parse(parameterExternalFile->getFileDocument().getAllContent()))
 		pTree = ValueTree::fromXml(*xml);
 
-	init(new EmbeddedSnippetCodeProvider(embeddedFile), pTree, sp);
+	init(m, new EmbeddedSnippetCodeProvider(embeddedFile), pTree, sp);
 }
 
 void DspNetwork::CodeManager::Entry::parameterAddedOrRemoved(ValueTree, bool)
@@ -2217,13 +2504,13 @@ void DspNetwork::CodeManager::Entry::propertyChanged(ValueTree, Identifier)
 	updateFile();
 }
 
-void DspNetwork::CodeManager::Entry::init(snex::ui::WorkbenchData::CodeProvider* codeProvider, const ValueTree& pTree,
+void DspNetwork::CodeManager::Entry::init(CodeManager& m, snex::ui::WorkbenchData::CodeProvider* codeProvider, const ValueTree& pTree,
 	ProcessorWithScriptingContent* sp)
 {
 	cp = codeProvider;
 	wb = new snex::ui::WorkbenchData();
 	wb->setCodeProvider(cp, dontSendNotification);
-	wb->setCompileHandler(new SnexSourceCompileHandler(wb.get(), sp));
+	wb->setCompileHandler(new SnexSourceCompileHandler(wb.get(), sp, &m));
 
 	parameterTree = pTree;
 
@@ -2249,11 +2536,12 @@ void DspNetwork::CodeManager::Entry::updateFile()
 	}
 }
 
-DspNetwork::CodeManager::SnexSourceCompileHandler::SnexSourceCompileHandler(snex::ui::WorkbenchData* d, ProcessorWithScriptingContent* sp_) :
+DspNetwork::CodeManager::SnexSourceCompileHandler::SnexSourceCompileHandler(snex::ui::WorkbenchData* d, ProcessorWithScriptingContent* sp_, CodeManager* manager_) :
 	Thread("SNEX Compile Thread", HISE_DEFAULT_STACK_SIZE),
 	CompileHandler(d),
 	ControlledObject(sp_->getMainController_()),
-	sp(sp_)
+	sp(sp_),
+	manager(manager_)
 {
 
 }
@@ -2287,6 +2575,9 @@ bool DspNetwork::CodeManager::SnexSourceCompileHandler::triggerCompilation()
 
 	if (shouldBeSync)
 	{
+		if (manager != nullptr && manager->deferCompilation(getParent()))
+			return false;
+
 		getParent()->handleCompilation();
 		return true;
 	}
@@ -345,6 +345,23 @@ public:
 	{
 		CodeManager(DspNetwork& p);
 
+		/** Collects all SNEX compilations that are triggered synchronously while this object exists
+		    and compiles them in parallel when it goes out of scope.
+
+			This is used during the network initialisation so that the SNEX nodes don't have to
+			compile one after another. The destructor blocks until every compilation has finished.
+		*/
+		struct ScopedParallelCompilation
+		{
+			ScopedParallelCompilation(CodeManager& m);
+			~ScopedParallelCompilation();
+
+		private:
+
+			CodeManager& manager;
+			const bool wasDeferring;
+		};
+
 		struct SnexSourceCompileHandler : public snex::ui::WorkbenchData::CompileHandler,
 		                                  public ControlledObject,
 		                                  public Thread
@@ -362,7 +379,7 @@ public:
 				JUCE_DECLARE_WEAK_REFERENCEABLE(SnexCompileListener);
 			};
 
-			SnexSourceCompileHandler(snex::ui::WorkbenchData* d, ProcessorWithScriptingContent* sp_);;
+			SnexSourceCompileHandler(snex::ui::WorkbenchData* d, ProcessorWithScriptingContent* sp_, CodeManager* manager_=nullptr);;
 
             ~SnexSourceCompileHandler();
 
@@ -400,6 +417,8 @@ public:
 
 			ProcessorWithScriptingContent* sp;
 
+			CodeManager* manager;
+
 			hise::SimpleReadWriteLock compileLock;
 
 			Array<WeakReference<SnexCompileListener>> compileListeners;
@@ -411,13 +430,24 @@ public:
 
 		StringArray getClassList(const Identifier& id, const String& fileExtension = "*.h");
 
+		/** Adds the workbench to the pending compilations if a ScopedParallelCompilation is active.
+		
+			Returns false if the compilation should be executed immediately.
+		*/
+		bool deferCompilation(snex::ui::WorkbenchData* wb);
+
 	private:
 
+		void compilePendingWorkbenches();
+
+		bool deferCompilations = false;
+		ReferenceCountedArray<snex::ui::WorkbenchData> pendingCompilations;
+
 		struct Entry
 		{
-			Entry(const Identifier& t, const File& targetFile, ProcessorWithScriptingContent* sp);
+			Entry(CodeManager& m, const Identifier& t, const File& targetFile, ProcessorWithScriptingContent* sp);
 
-			Entry(const Identifier& t, const ExternalScriptFile::Ptr& embeddedFile, ProcessorWithScriptingContent* sp);
+			Entry(CodeManager& m, const Identifier& t, const ExternalScriptFile::Ptr& embeddedFile, ProcessorWithScriptingContent* sp);
 
 			const Identifier type;
 			const File parameterFile;
@@ -436,7 +466,7 @@ public:
 
 			ExternalScriptFile::ResourceType resourceType;
 
-			void init(snex::ui::WorkbenchData::CodeProvider* codeProvider, const ValueTree& pTree, ProcessorWithScriptingContent* sp);
+			void init(CodeManager& m, snex::ui::WorkbenchData::CodeProvider* codeProvider, const ValueTree& pTree, ProcessorWithScriptingContent* sp);
 
 			void updateFile();
 
@@ -452,6 +482,43 @@ public:
 
 		DspNetwork& parent;
 	} codeManager;
+
+	/** The network compiled into a single SNEX node. 
+	
+		This uses the same code generator as the C++ export, so the parameter connections and
+		containers are resolved at compile time instead of being dispatched through the node tree.
+		The node tree is still used for the UI and the root parameters are forwarded to the 
+		compiled node. Any change to the network after freezing is ignored until the network 
+		is frozen again.
+	*/
+	struct FrozenJitNode
+	{
+		FrozenJitNode(DspNetwork& parent_);
+
+		/** Creates the SNEX code for the network and compiles it. */
+		Result compile();
+
+		void prepare(PrepareSpecs ps);
+
+		void process(ProcessDataDyn& d);
+
+		void handleHiseEvent(HiseEvent& e);
+
+		void reset();
+
+	private:
+
+		/** Sends the values of the root parameters to the compiled node if they have changed. */
+		void updateParameters();
+
+		DspNetwork& parent;
+		snex::jit::GlobalScope scope;
+		snex::jit::JitCompiledNode::Ptr node;
+		Array<double> lastValues;
+		bool channelMismatch = false;
+	};
+
+	ScopedPointer<FrozenJitNode> frozenNode;
 #endif
 
 	void setNumChannels(int newNumChannels);
@@ -524,6 +591,9 @@ public:
 	/** Defines whether the UI controls of this script control the parameters or regular script callbacks. */
 	void setForwardControlsToParameters(bool shouldForward);
 
+	/** Compiles the network into a single JIT compiled node that is processed instead of the node tree. Returns false if the network can't be compiled. */
+	bool freezeToJit(bool shouldBeFrozen);
+
 	/** Initialise processing of all nodes. */
 	void prepareToPlay(double sampleRate, double blockSize);
 
@@ -597,6 +667,9 @@ public:
 
 	Result checkBeforeCompilation();
 
+	/** Returns true if the network is processed by a JIT compiled node (see freezeToJit()). */
+	bool isFrozenToJit() const;
+
 	struct SelectionListener
 	{
 		virtual ~SelectionListener() {};
@@ -1120,8 +1120,8 @@ scriptnode::ParameterDataList CloneNode::createInternalParameterList()
 	}
 	{
 		DEFINE_PARAMETERDATA(CloneNode, SplitSignal);
-		p.setRange({ 0.0, 2.0, 1.0 });
-        p.setParameterValueNames({"Serial", "Parallel", "Copy"});
+		p.setRange({ 0.0, 3.0, 1.0 });
+        p.setParameterValueNames({"Serial", "Parallel", "Copy", "Multithreaded"});
 		p.setDefaultValue(2.0);
 		data.add(std::move(p));
 	}
@@ -210,6 +210,10 @@ USE_ASMJIT_NAMESPACE;
 		auto float4Type = new SpanType(TypeInfo(Types::ID::Float), 4);
 		float4Type->setAlias(NamespacedIdentifier("float4"));
 		namespaceHandler.registerComplexTypeOrReturnExisting(float4Type);
+
+		auto float8Type = new SpanType(TypeInfo(Types::ID::Float), 8);
+		float8Type->setAlias(NamespacedIdentifier("float8"));
+		namespaceHandler.registerComplexTypeOrReturnExisting(float8Type);
 	}
 
 	void BaseCompiler::executePass(Pass p, BaseScope* scope, ReferenceCountedObject* statement)
@@ -287,6 +287,12 @@ String ValueTreeBuilder::getGlueCode(ValueTreeBuilder::FormatGlueCode c)
 	{
 		switch (c)
 		{
+			case FormatGlueCode::PreNamespaceCode:
+			{
+				// the SNEX preprocessor supports function macros too
+				addConnectionMacros();
+				return {};
+			}
 			case FormatGlueCode::WrappedNamespace: return "impl";
 			case FormatGlueCode::PublicDefinition:
 			{
@@ -330,13 +336,7 @@ String ValueTreeBuilder::getGlueCode(ValueTreeBuilder::FormatGlueCode c)
                 return false;
             });
             
-            addComment("These will improve the readability of the connection definition", Base::CommentType::RawWithNewLine);
-            
-            *this << "#define getT(Idx) template get<Idx>()";
-            *this << "#define connectT(Idx, target) template connect<Idx>(target)";
-            *this << "#define getParameterT(Idx) template getParameter<Idx>()";
-            *this << "#define setParameterT(Idx, value) template setParameter<Idx>(value)";
-            *this << "#define setParameterWT(Idx, value) template setWrapParameter<Idx>(value)";
+            addConnectionMacros();
             
 			UsingNamespace(*this, NamespacedIdentifier("scriptnode"));
 			UsingNamespace(*this, NamespacedIdentifier("snex"));
@@ -374,6 +374,17 @@ String ValueTreeBuilder::getGlueCode(ValueTreeBuilder::FormatGlueCode c)
 	return {};
 }
 
+void ValueTreeBuilder::addConnectionMacros()
+{
+	addComment("These will improve the readability of the connection definition", Base::CommentType::RawWithNewLine);
+
+	*this << "#define getT(Idx) template get<Idx>()";
+	*this << "#define connectT(Idx, target) template connect<Idx>(target)";
+	*this << "#define getParameterT(Idx) template getParameter<Idx>()";
+	*this << "#define setParameterT(Idx, value) template setParameter<Idx>(value)";
+	*this << "#define setParameterWT(Idx, value) template setWrapParameter<Idx>(value)";
+}
+
 void ValueTreeBuilder::addNodeComment(Node::Ptr n)
 {
 	auto nodeComment = n->nodeTree[PropertyIds::Comment].toString();
@@ -1056,7 +1067,7 @@ Node::Ptr ValueTreeBuilder::parseCloneContainer(Node::Ptr u)
     if(!hasNumCloneAutomation)
         cloneClassId << "fix_";
     
-    static const StringArray names = { "chain", "split", "copy"};
+    static const StringArray names = { "chain", "split", "copy", "threaded" };
     
     cloneClassId << "clone";
     cloneClassId << names[(int)processType];
@@ -580,6 +580,14 @@ struct ValueTreeBuilder: public Base
 		setHeaderForFormat();
 	}
 
+	/** The constructor always creates the DLL format (the workbench and test case callers depend on it).
+		Call this before createCppCode() to use another format. */
+	void setOutputFormat(Format newFormat)
+	{
+		outputFormat = newFormat;
+		setHeaderForFormat();
+	}
+
 	BuildResult createCppCode()
 	{
 		rebuild();
@@ -653,6 +661,9 @@ private:
 
 	void setHeaderForFormat();
 
+	/** Adds the macros that are used by the connection code (getT, connectT, etc). */
+	void addConnectionMacros();
+
 	String getCurrentCode() const { return toString(); }
 
 
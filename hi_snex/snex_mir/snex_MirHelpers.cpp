@@ -407,7 +407,7 @@ String snex::mir::TypeConverters::TypeInfo2MirTextType(const TypeInfo& t, bool r
 
 String snex::mir::TypeConverters::MirTypeAndToken2InstructionText(MIR_type_t type, const String& token)
 {
-	static StringPairArray intOps, fltOps, dblOps;
+	static thread_local StringPairArray intOps, fltOps, dblOps;
 
 	intOps.set(JitTokens::assign_, "MOV");
 	intOps.set(JitTokens::plus, "ADD");
@@ -276,8 +276,141 @@ ValueTree MirFunctionCollection::fillLayoutWithData(const String& dataId, const
 
 
 
-void* MirCompiler::currentConsole = nullptr;
-Array<StaticFunctionPointer> MirCompiler::currentFunctions;
+CriticalSection MirModuleCache::lock;
+File MirModuleCache::directory;
+String MirModuleCache::salt;
+MirModuleCache::LogFunction MirModuleCache::logFunction;
+std::atomic<int> MirModuleCache::numHits = { 0 };
+std::atomic<int> MirModuleCache::numMisses = { 0 };
+
+void MirModuleCache::setCacheDirectory(const File& newDirectory, const String& versionString, const LogFunction& newLogFunction)
+{
+	ScopedLock sl(lock);
+
+	directory = newDirectory;
+	salt = versionString;
+	logFunction = newLogFunction;
+
+	if (directory != File())
+		directory.createDirectory();
+}
+
+bool MirModuleCache::isEnabled()
+{
+	ScopedLock sl(lock);
+	return directory.isDirectory();
+}
+
+String MirModuleCache::createHash(const String& preprocessedCode, const String& registeredSymbols, const StringArray& optimizations)
+{
+	MemoryOutputStream mos;
+
+	{
+		ScopedLock sl(lock);
+		mos << salt;
+	}
+
+	mos << CacheFormatVersion;
+	mos << preprocessedCode;
+	mos << registeredSymbols;
+	mos << optimizations.joinIntoString(";");
+
+	return SHA256(mos.getData(), mos.getDataSize()).toHexString();
+}
+
+bool MirModuleCache::load(const String& hash, MemoryBlock& mirBinary, ValueTree& globalData)
+{
+	auto f = getCacheFile(hash);
+
+	if (f.existsAsFile())
+	{
+		FileInputStream fis(f);
+
+		if (fis.openedOk())
+		{
+			auto numBytes = (size_t)fis.readInt64();
+			auto checksum = fis.readString();
+
+			// The MIR reader will not recover from invalid data, so we need to make sure that the file is intact
+			if (numBytes > 0 && 
+				(int64)numBytes <= fis.getNumBytesRemaining() && 
+				fis.readIntoMemoryBlock(mirBinary, (ssize_t)numBytes) == numBytes &&
+				SHA256(mirBinary).toHexString() == checksum)
+			{
+				globalData = ValueTree::readFromStream(fis);
+				numHits++;
+				return true;
+			}
+		}
+
+		f.deleteFile();
+	}
+
+	numMisses++;
+	return false;
+}
+
+void MirModuleCache::store(const String& hash, const MemoryBlock& mirBinary, const ValueTree& globalData)
+{
+	if (mirBinary.getSize() == 0)
+		return;
+
+	auto f = getCacheFile(hash);
+
+	// write to a temporary file so that a parallel load never sees a half written entry
+	TemporaryFile tmp(f);
+
+	{
+		FileOutputStream fos(tmp.getFile());
+
+		if (!fos.openedOk())
+			return;
+
+		fos.writeInt64((int64)mirBinary.getSize());
+		fos.writeString(SHA256(mirBinary).toHexString());
+		fos.write(mirBinary.getData(), mirBinary.getSize());
+		globalData.writeToStream(fos);
+		fos.flush();
+	}
+
+	tmp.overwriteTargetFileWithTemporary();
+}
+
+void MirModuleCache::clear()
+{
+	ScopedLock sl(lock);
+
+	if (directory.isDirectory())
+	{
+		for (auto f : directory.findChildFiles(File::findFiles, false, "*.mirc"))
+			f.deleteFile();
+	}
+
+	numHits = 0;
+	numMisses = 0;
+}
+
+void MirModuleCache::log(const String& message)
+{
+	LogFunction f;
+
+	{
+		ScopedLock sl(lock);
+		f = logFunction;
+	}
+
+	if (f)
+		f(message);
+}
+
+File MirModuleCache::getCacheFile(const String& hash)
+{
+	ScopedLock sl(lock);
+	return directory.getChildFile(hash).withFileExtension("mirc");
+}
+
+thread_local void* MirCompiler::currentConsole = nullptr;
+thread_local Array<StaticFunctionPointer> MirCompiler::currentFunctions;
 
 MirCompiler::MirCompiler(jit::GlobalScope& m):
 	r(Result::fail("nothing compiled")),
@@ -292,6 +425,8 @@ snex::jit::FunctionCollectionBase* MirCompiler::compileMirCode(const ValueTree&
 	if (currentFunctionClass == nullptr)
 		currentFunctionClass = new MirFunctionCollection();
 
+	cacheState = cacheHash.isNotEmpty() ? CacheState::Miss : CacheState::Disabled;
+
 	MirBuilder b(getFunctionClass()->ctx, ast);
 
     b.setDataLayout(dataLayout);
@@ -304,6 +439,9 @@ snex::jit::FunctionCollectionBase* MirCompiler::compileMirCode(const ValueTree&
 		auto ok = compileMirCode(code);
         
         getFunctionClass()->globalData = b.getGlobalData();
+
+		if (ok != nullptr && cacheState == CacheState::Miss)
+			MirModuleCache::store(cacheHash, lastModuleBinary, getFunctionClass()->globalData);
         
         return ok;
 	}
@@ -370,6 +508,31 @@ bool MirCompiler::isExternalFunction(const String& sig)
 	return false;
 }
 
+struct MirBinaryStream
+{
+	static int write(MIR_context_t, uint8_t byte)
+	{
+		jassert(currentOutput != nullptr);
+		return currentOutput->writeByte((char)byte) ? 1 : 0;
+	}
+
+	static int read(MIR_context_t)
+	{
+		jassert(currentInput != nullptr);
+
+		if (currentInput->isExhausted())
+			return EOF;
+
+		return (int)(uint8)currentInput->readByte();
+	}
+
+	static thread_local OutputStream* currentOutput;
+	static thread_local InputStream* currentInput;
+};
+
+thread_local OutputStream* MirBinaryStream::currentOutput = nullptr;
+thread_local InputStream* MirBinaryStream::currentInput = nullptr;
+
 snex::jit::FunctionCollectionBase* MirCompiler::compileMirCode(const String& code)
 {
     if (SyntaxTreeExtractor::isBase64Tree(code))
@@ -387,84 +550,23 @@ snex::jit::FunctionCollectionBase* MirCompiler::compileMirCode(const String& cod
 
 	try
 	{
-        File fs;
-        
 		auto ctx = getFunctionClass()->ctx;
 
 		MIR_scan_string(ctx, code.getCharPointer().getAddress());
 
 		if (auto m = DLIST_TAIL(MIR_module_t, *MIR_get_module_list(ctx)))
 		{
-			getFunctionClass()->modules.add(m);
-			MIR_load_module(ctx, m);
-			MIR_gen_init(ctx);
-			MIR_gen_set_optimize_level(ctx, 3);
-            //MIR_gen_set_debug_file(ctx, 1, dbgfile);
-			MIR_link(ctx, MIR_set_gen_interface, &MirCompiler::resolve);
-            
-            for(auto& m: getFunctionClass()->modules)
-            {
-                for (auto f = DLIST_HEAD(MIR_item_t, m->items); f != NULL; f = DLIST_NEXT(MIR_item_t, f))
-                {
-                    if(f->item_type == MIR_data_item)
-                    {
-                        String s(f->u.data->name);
-                        
-                        if(s.isNotEmpty() && !s.startsWithChar('.'))
-                        {
-                            getFunctionClass()->dataItems.set(s, f->addr);
-
-							NamespacedIdentifier id(s);
-							TypeInfo t(Types::ID::Integer, false, false);
-
-                            getFunctionClass()->dataIds.add(jit::Symbol(id, t));
-                        }
-                    }
-					else if (f->item_type == MIR_func_item)
-					{
-						String s(f->u.data->name);
-
-						s = s.upToLastOccurrenceOf("_", false, false);
-
-						if (s.isNotEmpty())
-						{
-							NamespacedIdentifier id(s);
-							getFunctionClass()->allFunctions.add(id);
-						}
-
-						auto main_func = f;
-						
-						jit::FunctionData fd;
-						fd.id = NamespacedIdentifier::fromString(s);
-
-						auto x = main_func->u.func;
-
-						if (x->nres != 0)
-							fd.returnType = TypeInfo(MirHelpers::getTypeFromMirEnum(x->res_types[0]), false, false);
-						else
-							fd.returnType = Types::ID::Void;
-
-						for (uint32 i = 0; i < x->nargs; i++)
-						{
-							auto v = x->vars->varr[i];
-							fd.addArgs(v.name, TypeInfo(MirHelpers::getTypeFromMirEnum(v.type)));
-						}
-
-						fd.function = MIR_gen(ctx, main_func);
-
-						if (fd.function != nullptr)
-							fd.function = main_func->u.func->machine_code;
-
-						//fd.numBytes = main_func->u.func. u.func->num_bytes;
-
-						getFunctionClass()->functionMap.emplace(s, fd);
-					}
-                }
-            }
-
-			MIR_gen_finish(ctx);
-
-			return getFunctionClass();
+			if (cacheState == CacheState::Miss)
+			{
+				// Write the module before it is linked (the linker will modify the function bodies).
+				lastModuleBinary.reset();
+				MemoryOutputStream mos(lastModuleBinary, false);
+				MirBinaryStream::currentOutput = &mos;
+				MIR_write_module_with_func(ctx, MirBinaryStream::write, m);
+				MirBinaryStream::currentOutput = nullptr;
+			}
+
+			return loadAndGenerateModule(m);
 		}
 		else
 		{
@@ -477,10 +579,116 @@ snex::jit::FunctionCollectionBase* MirCompiler::compileMirCode(const String& cod
 	}
 
 	return nullptr;
+}
+
+snex::jit::FunctionCollectionBase* MirCompiler::compileMirBinary(const MemoryBlock& mirBinary, const ValueTree& globalData)
+{
+	if (currentFunctionClass == nullptr)
+		currentFunctionClass = new MirFunctionCollection();
 
+	r = Result::ok();
+	cacheState = CacheState::Hit;
+
+	try
+	{
+		auto ctx = getFunctionClass()->ctx;
+
+		MemoryInputStream mis(mirBinary, false);
+		MirBinaryStream::currentInput = &mis;
+		MIR_read_with_func(ctx, MirBinaryStream::read);
+		MirBinaryStream::currentInput = nullptr;
+
+		assembly = "; MIR module was loaded from the cache";
+
+		if (auto m = DLIST_TAIL(MIR_module_t, *MIR_get_module_list(ctx)))
+		{
+			getFunctionClass()->globalData = globalData;
+			return loadAndGenerateModule(m);
+		}
+
+		r = Result::fail("Can't find module");
+	}
+	catch (String& error)
+	{
+		MirBinaryStream::currentInput = nullptr;
+		r = Result::fail(error);
+	}
+
+	return nullptr;
 }
 
+snex::jit::FunctionCollectionBase* MirCompiler::loadAndGenerateModule(MIR_module* m)
+{
+	auto ctx = getFunctionClass()->ctx;
+
+	getFunctionClass()->modules.add(m);
+	MIR_load_module(ctx, m);
+	MIR_gen_init(ctx);
+	MIR_gen_set_optimize_level(ctx, 3);
+	MIR_link(ctx, MIR_set_gen_interface, &MirCompiler::resolve);
+
+	for(auto& m: getFunctionClass()->modules)
+	{
+		for (auto f = DLIST_HEAD(MIR_item_t, m->items); f != NULL; f = DLIST_NEXT(MIR_item_t, f))
+		{
+			if(f->item_type == MIR_data_item)
+			{
+				String s(f->u.data->name);
+                
+				if(s.isNotEmpty() && !s.startsWithChar('.'))
+				{
+					getFunctionClass()->dataItems.set(s, f->addr);
+
+					NamespacedIdentifier id(s);
+					TypeInfo t(Types::ID::Integer, false, false);
+
+					getFunctionClass()->dataIds.add(jit::Symbol(id, t));
+				}
+			}
+			else if (f->item_type == MIR_func_item)
+			{
+				String s(f->u.data->name);
+
+				s = s.upToLastOccurrenceOf("_", false, false);
+
+				if (s.isNotEmpty())
+				{
+					NamespacedIdentifier id(s);
+					getFunctionClass()->allFunctions.add(id);
+				}
+
+				auto main_func = f;
+				
+				jit::FunctionData fd;
+				fd.id = NamespacedIdentifier::fromString(s);
+
+				auto x = main_func->u.func;
+
+				if (x->nres != 0)
+					fd.returnType = TypeInfo(MirHelpers::getTypeFromMirEnum(x->res_types[0]), false, false);
+				else
+					fd.returnType = Types::ID::Void;
+
+				for (uint32 i = 0; i < x->nargs; i++)
+				{
+					auto v = x->vars->varr[i];
+					fd.addArgs(v.name, TypeInfo(MirHelpers::getTypeFromMirEnum(v.type)));
+				}
 
+				fd.function = MIR_gen(ctx, main_func);
+
+				if (fd.function != nullptr)
+					fd.function = main_func->u.func->machine_code;
+
+				getFunctionClass()->functionMap.emplace(s, fd);
+			}
+		}
+	}
+
+	MIR_gen_finish(ctx);
+
+	return getFunctionClass();
+}
 
 juce::Result MirCompiler::getLastError() const
 {
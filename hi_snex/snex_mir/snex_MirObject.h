@@ -47,13 +47,84 @@ using jit::StaticFunctionPointer;
 
 struct MirFunctionCollection;
 
+/** A content addressed file cache for MIR modules.
+
+	The MIR module that is created from the syntax tree will be written in the binary MIR format
+	to a file with the hash of the preprocessed code, the registered symbols, the optimisation passes
+	and the HISE version as name. The next time the same code is compiled, the module will be read from
+	the cache file and the compiler will only run the parsing passes that register the types. The code
+	generation passes, the MirBuilder and the MIR text parsing are skipped.
+
+	The cache is disabled until you call setCacheDirectory().
+*/
+struct MirModuleCache
+{
+	using LogFunction = std::function<void(const String&)>;
+
+	/** Bump this whenever the MirBuilder output or the cache file layout changes. */
+	static constexpr int CacheFormatVersion = 1;
+
+	/** Enables the cache (or disables it if you pass in a non existing directory).
+
+		The version string will be added to the hash, so that modules from a different build are not reused.
+	*/
+	static void setCacheDirectory(const File& newDirectory, const String& versionString, const LogFunction& newLogFunction={});
+
+	static bool isEnabled();
+
+	/** Creates the cache key for the given code and settings. 
+	
+		Pass in the dump of the namespace handler before the compilation so that changes to the registered constants and types invalidate the entry.
+	*/
+	static String createHash(const String& preprocessedCode, const String& registeredSymbols, const StringArray& optimizations);
+
+	/** Loads the binary MIR module and the global data from the cache. Returns false if there is no entry with the given hash. */
+	static bool load(const String& hash, MemoryBlock& mirBinary, ValueTree& globalData);
+
+	/** Writes the binary MIR module and the global data to the cache. */
+	static void store(const String& hash, const MemoryBlock& mirBinary, const ValueTree& globalData);
+
+	/** Removes all cache files. */
+	static void clear();
+
+	static void log(const String& message);
+
+	static int getNumHits() { return numHits.load(); }
+	static int getNumMisses() { return numMisses.load(); }
+
+private:
+
+	static File getCacheFile(const String& hash);
+
+	static CriticalSection lock;
+	static File directory;
+	static String salt;
+	static LogFunction logFunction;
+
+	static std::atomic<int> numHits;
+	static std::atomic<int> numMisses;
+};
+
 struct MirCompiler
 {
+	enum class CacheState
+	{
+		Disabled,
+		Hit,
+		Miss
+	};
+
 	MirCompiler(jit::GlobalScope& m);
 
 	jit::FunctionCollectionBase* compileMirCode(const String& code);
 	jit::FunctionCollectionBase* compileMirCode(const ValueTree& ast);
 
+	/** Loads a module that was written to the MirModuleCache. */
+	jit::FunctionCollectionBase* compileMirBinary(const MemoryBlock& mirBinary, const ValueTree& globalData);
+
+	/** Stores the module in the MirModuleCache after the next successful call to compileMirCode(ValueTree). */
+	void setCacheHash(const String& newHash) { cacheHash = newHash; }
+
     void setDataLayout(const Array<ValueTree>& dataTree);
     
 	Result getLastError() const;;
@@ -67,6 +138,9 @@ struct MirCompiler
 	static bool isExternalFunction(const String& sig);
     
     String getAssembly() const { return assembly; }
+
+	/** Returns whether the last compilation used the MirModuleCache. */
+	CacheState getLastCacheState() const { return cacheState; }
     
 	jit::FunctionCollectionBase::Ptr currentFunctionClass;
 
@@ -76,11 +150,18 @@ struct MirCompiler
 
 	MirFunctionCollection* getFunctionClass();
 
+	jit::FunctionCollectionBase* loadAndGenerateModule(MIR_module* m);
+
+	CacheState cacheState = CacheState::Disabled;
+	String cacheHash;
+
     Array<ValueTree> dataLayout;
+	MemoryBlock lastModuleBinary;
     String assembly;
     
-	static Array<StaticFunctionPointer> currentFunctions;
-	static void* currentConsole;
+	// thread local so that multiple SNEX objects can be compiled in parallel
+	static thread_local Array<StaticFunctionPointer> currentFunctions;
+	static thread_local void* currentConsole;
 
 	Result r;
 
@@ -135,20 +135,15 @@ struct JitCompiledNode : public ReferenceCountedObject,
 		}
 	}
 
-#if 0
+	/** Calls the parameter function with the given index. Unlike the callbacks from getParameterList()
+	    this is not limited to the first five parameters. */
 	void setParameterDynamic(int index, double value)
 	{
-		if (index == 0) setParameterStatic<0>(this, value);
-		if (index == 1) setParameterStatic<1>(this, value);
-		if (index == 2) setParameterStatic<2>(this, value);
-		if (index == 3) setParameterStatic<3>(this, value);
-		if (index == 4) setParameterStatic<4>(this, value);
-		if (index == 5) setParameterStatic<5>(this, value);
-		if (index == 6) setParameterStatic<6>(this, value);
-		if (index == 7) setParameterStatic<7>(this, value);
-		if (index == 8) setParameterStatic<8>(this, value);
+		if (isPositiveAndBelow(index, parameterFunctions.size()))
+			parameterFunctions.getReference(index).callVoid(value);
 	}
-#endif
+
+	int getNumParameters() const { return parameterFunctions.size(); }
 
     String getAssembly() const
     {
@@ -38,7 +38,7 @@ USE_ASMJIT_NAMESPACE;
 
 
 
-int Compiler::compileCount = 0;
+std::atomic<int> Compiler::compileCount = { 0 };
 
  void Compiler::reset()
  {
@@ -183,6 +183,22 @@ juce::Result Compiler::getCompileResult()
 }
 
 
+#if SNEX_MIR_BACKEND
+static void logMirCacheState(BaseCompiler* compiler, mir::MirCompiler::CacheState state)
+{
+	if (state == mir::MirCompiler::CacheState::Disabled)
+		return;
+
+	auto isHit = state == mir::MirCompiler::CacheState::Hit;
+
+	String m;
+	m << "MIR cache " << (isHit ? "hit" : "miss") << " (" << String(mir::MirModuleCache::getNumHits()) << " hits, " << String(mir::MirModuleCache::getNumMisses()) << " misses)";
+
+	compiler->logMessage(BaseCompiler::ProcessMessage, m);
+	mir::MirModuleCache::log(m);
+}
+#endif
+
 JitObject Compiler::compileJitObject(const juce::String& code)
 {
 	compileCount++;
@@ -205,7 +221,43 @@ JitObject Compiler::compileJitObject(const juce::String& code)
 	}
 	
 
-	
+#if SNEX_MIR_BACKEND
+
+	String cacheHash;
+
+	if (mir::MirModuleCache::isEnabled() && compiler->getLastResult().wasOk())
+	{
+		cacheHash = mir::MirModuleCache::createHash(preprocessedCode, compiler->namespaceHandler.dump(), memory.getOptimizationPassList());
+
+		MemoryBlock mirBinary;
+		ValueTree globalData;
+
+		if (mir::MirModuleCache::load(cacheHash, mirBinary, globalData))
+		{
+			mir::MirCompiler mc(memory);
+
+			JitObject mirObject(mc.compileMirBinary(mirBinary, globalData));
+
+			if (mc.getLastError().wasOk())
+			{
+				// The JitObject users need the types in the namespace handler,
+				// but we can skip the optimisation and code generation passes.
+				compiler->parseOnly = true;
+				compiler->compileAndGetScope(preprocessedCode);
+				compiler->parseOnly = false;
+
+				cr = compiler->getLastResult();
+
+				logMirCacheState(compiler, mc.getLastCacheState());
+
+				assembly = mc.getAssembly();
+
+				return cr.wasOk() ? mirObject : JitObject();
+			}
+		}
+	}
+
+#endif
 
 	JitObject snexObject(compiler->compileAndGetScope(preprocessedCode));
 
@@ -220,11 +272,14 @@ JitObject Compiler::compileJitObject(const juce::String& code)
 		mir::MirCompiler mc(memory);
 
 		mc.setDataLayout(layout);
+		mc.setCacheHash(cacheHash);
 
 		JitObject mirObject(mc.compileMirCode(getAST()));
 
 		cr = mc.getLastError();
 
+		logMirCacheState(compiler, mc.getLastCacheState());
+
 #if SNEX_INCLUDE_NMD_ASSEMBLY
 
 		assembly = {};
@@ -131,7 +131,7 @@ public:
 	FunctionClass::Ptr getInbuiltFunctionClass();
 	void initInbuildFunctions();
 
-	static int compileCount;
+	static std::atomic<int> compileCount;
 
 	void reset();
 
@@ -560,6 +560,50 @@ public:
 
 	}
 
+	void testMirModuleCache()
+	{
+#if SNEX_MIR_BACKEND
+		beginTest("Testing MIR module cache");
+
+		auto dir = File::getSpecialLocation(File::tempDirectory).getChildFile("snex_mir_cache_test");
+		dir.deleteRecursively();
+
+		mir::MirModuleCache::setCacheDirectory(dir, "test");
+		mir::MirModuleCache::clear();
+
+		const String code = "float x = 2.0f; float test(float input){ return input * x; }";
+
+		for (int i = 0; i < 2; i++)
+		{
+			GlobalScope s;
+			Compiler compiler(s);
+			auto obj = compiler.compileJitObject(code);
+
+			expect(compiler.getCompileResult().wasOk(), "compile error: " + compiler.getCompileResult().getErrorMessage());
+			expectEquals(obj["test"].call<float>(4.0f), 8.0f, "wrong result in run " + String(i));
+		}
+
+		expectEquals(mir::MirModuleCache::getNumMisses(), 1, "first compilation should miss");
+		expectEquals(mir::MirModuleCache::getNumHits(), 1, "second compilation should hit");
+
+		// A corrupt file must be rejected and replaced
+		for (auto f : dir.findChildFiles(File::findFiles, false, "*.mirc"))
+			f.replaceWithText("corrupt");
+
+		{
+			GlobalScope s;
+			Compiler compiler(s);
+			auto obj = compiler.compileJitObject(code);
+			expectEquals(obj["test"].call<float>(3.0f), 6.0f, "wrong result after corrupt cache");
+		}
+
+		expectEquals(mir::MirModuleCache::getNumMisses(), 2, "corrupt file should miss");
+
+		mir::MirModuleCache::setCacheDirectory({}, {});
+		dir.deleteRecursively();
+#endif
+	}
+
 	
 
 	void testValueTreeCodeBuilder()
@@ -745,6 +789,7 @@ public:
 		testSpan<int>();
 		testSpan<float>();
 		testSpan<double>();
+		testAvxSpanOperations();
 		testStructs();
 		testUsingAliases();
 		testProcessData();
@@ -752,6 +797,7 @@ public:
 		testMacOSRelocation();
 
 		testExternalFunctionCalls();
+		testMirModuleCache();
 		
 		testEvents();
 
@@ -3416,6 +3462,84 @@ private:
 		testSpanOperatorWith2Spans<OpType, 1, 3>();
 		testSpanOperatorWith2Spans<OpType, 3, 1>();
 		testSpanOperatorWith2Spans<OpType, 1, 1>();
+		testSpanOperatorWith2Spans<OpType, 8, 8>();
+		testSpanOperatorWith2Spans<OpType, 64, 64>();
+	}
+
+	void testAvxSpanOperations()
+	{
+		beginTest("Testing 8-wide span operations");
+
+		float8 alignedSpan;
+		expect(alignedSpan.isAlignedTo32Byte(), "float8 alignment");
+
+#if SNEX_USE_AVX
+		expect(span<float, 16>::isAvxSimdable(), "span<float, 16> should use AVX");
+		expect(!span<float, 12>::isAvxSimdable(), "span<float, 12> should not use AVX");
+#endif
+
+		Random r;
+
+		span<float, 64, 32> a, b;
+		span<float, 64> scalarA, simd4A;
+
+		for (int i = 0; i < 64; i++)
+		{
+			a[i] = r.nextFloat();
+			b[i] = r.nextFloat() + 0.5f;
+			scalarA[i] = a[i];
+			simd4A[i] = a[i];
+		}
+
+		span<float, 64> simd4B;
+		FloatVectorOperations::copy(simd4B.begin(), b.begin(), 64);
+
+		// 8-wide path (uses AVX if enabled)
+		auto& a8 = a.toSimd8();
+		auto& b8 = b.toSimd8();
+
+		for (int i = 0; i < a8.size(); i++)
+		{
+			a8[i] *= b8[i];
+			a8[i] += 0.25f;
+			a8[i] /= b8[i];
+			a8[i] -= b8[i];
+		}
+
+		// 4-wide SSE path
+		auto& a4 = simd4A.toSimd();
+		auto& b4 = simd4B.toSimd();
+
+		for (int i = 0; i < a4.size(); i++)
+		{
+			a4[i] *= b4[i];
+			a4[i] += 0.25f;
+			a4[i] /= b4[i];
+			a4[i] -= b4[i];
+		}
+
+		for (int i = 0; i < 64; i++)
+		{
+			auto& v = scalarA[i];
+			v *= b[i];
+			v += 0.25f;
+			v /= b[i];
+			v -= b[i];
+
+			expectWithinAbsoluteError<float>(a[i], v, 1e-6f, "8-wide vs. scalar at " + String(i));
+			expectWithinAbsoluteError<float>(a[i], simd4A[i], 1e-6f, "8-wide vs. 4-wide at " + String(i));
+		}
+
+		dyn<float> d;
+		d.referTo(a);
+
+		expect(d.isSimdable8(), "aligned span should be 8-wide simdable");
+		expectEquals(d.toSimd8().size(), 8, "8-wide dyn size");
+
+		ScopedPointer<HiseJITTestCase<float>> test;
+
+		CREATE_TEST("float test(float input){ float8 d; d = input; d *= 2.0f; return d[7]; }");
+		EXPECT("float8 alias", 4.0f, 8.0f);
 	}
 
 	void testSpanOperators()
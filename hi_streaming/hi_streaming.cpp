@@ -8,6 +8,10 @@
 #include "hi_streaming/StreamingSamplerSound.cpp"
 #include "hi_streaming/StreamingSamplerVoice.cpp"
 
+#if HI_RUN_UNIT_TESTS
+#include "hi_streaming/SharedStreamSegmentsTests.cpp"
+#endif
+
 #include "timestretch//time_stretcher.cpp"
 
 
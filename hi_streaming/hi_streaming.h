@@ -96,6 +96,16 @@ Set this to false to disable the release start feature.
 #define HISE_SAMPLER_ALLOW_RELEASE_START 1
 #endif
 
+/** Config: HISE_SAMPLER_SHARE_STREAMING_SEGMENTS
+
+If this is enabled, voices that stream the same part of a sample copy the decoded data from each other instead of
+reading it from the disk again. This is disabled by default until the shared segments have been tested in more projects.
+
+*/
+#ifndef HISE_SAMPLER_SHARE_STREAMING_SEGMENTS
+#define HISE_SAMPLER_SHARE_STREAMING_SEGMENTS 0
+#endif
+
 
 #include "hi_streaming/lockfree_fifo/readerwriterqueue.h"
 #include "hi_streaming/lockfree_fifo/concurrentqueue.h"
@@ -133,6 +133,9 @@ public:
 
 	String getFileName(int channelIndex, int sampleIndex) const;
 
+	/** Returns the monolith file that contains the given sample. */
+	File getFile(int channelIndex, int sampleIndex) const;
+
 	int64 getMonolithOffset(int sampleIndex) const;
 
 	int getNumSamplesInMonolith() const;
@@ -153,8 +156,6 @@ private:
 
 	int getFileIndex(int channelIndex, int sampleIndex) const;
 
-	File getFile(int channelIndex, int sampleIndex) const;
-
 	struct SampleInfo
 	{
 		double sampleRate;
@@ -51,6 +51,8 @@ struct SampleThreadPool::Pimpl
 
 	CriticalSection clearLock;
 
+	ReferenceCountedObjectPtr<SharedStreamSegments> sharedStreamSegments = new SharedStreamSegments();
+
 	std::atomic<double> diskUsage;
 	int64 startTime, endTime;
 	moodycamel::ReaderWriterQueue<WeakReference<Job>> jobQueue;
@@ -76,6 +78,11 @@ double SampleThreadPool::getDiskUsage() const noexcept
 	return pimpl->diskUsage.load();
 }
 
+SharedStreamSegments* SampleThreadPool::getSharedStreamSegments()
+{
+	return pimpl->sharedStreamSegments.get();
+}
+
 void SampleThreadPool::clearPendingTasks()
 {
 	ScopedLock sl(pimpl->clearLock);
@@ -35,6 +35,8 @@
 
 namespace hise { using namespace juce;
 
+class SharedStreamSegments;
+
 class SampleThreadPool : public Thread
 {
 public:
@@ -107,6 +109,9 @@ public:
 
 	void run() override;
 
+	/** Returns the registry of decoded segments that the SampleLoaders of this pool can share. */
+	SharedStreamSegments* getSharedStreamSegments();
+
 	struct Pimpl;
 
 	
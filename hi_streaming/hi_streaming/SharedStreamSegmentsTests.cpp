@@ -0,0 +1,263 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   ===========================================================================
+*/
+
+namespace hise {
+using namespace juce;
+
+/** Streams a sound with multiple SampleLoaders in non-realtime mode (so the segments are filled synchronously)
+	and checks that the shared segments produce the same output as a single loader that reads from the disk.
+*/
+class SharedStreamSegmentsTests : public UnitTest
+{
+public:
+
+	SharedStreamSegmentsTests() : UnitTest("Shared stream segments Tests", "Streaming") {}
+
+	void runTest() override
+	{
+		beginTest("Setup");
+
+		TemporaryFile tempFile(".wav");
+		writeTestFile(tempFile.getFile());
+
+		StreamingSamplerSoundPool soundPool;
+		StreamingSamplerSound::Ptr sound = new StreamingSamplerSound(tempFile.getFile().getFullPathName(), &soundPool);
+		sound->setPreloadSize(PreloadSize);
+
+		expect(!sound->isEntireSampleLoaded(), "the sound must be streamed");
+
+		AudioSampleBuffer reference;
+
+		{
+			SampleThreadPool pool(nullptr);
+			SampleLoader single(&pool);
+			prepareLoader(single);
+
+			renderInLockstep({ &single }, sound.get(), { &reference });
+		}
+
+		testTwoLoaders(sound.get(), reference);
+		testInvalidationAfterRefill(sound.get(), reference);
+		testInvalidationAfterClear(sound.get(), reference);
+		testInvalidationAfterResize(sound.get(), reference);
+		testReleaseStateKey(sound.get());
+	}
+
+private:
+
+	static constexpr int NumSamplesInFile = 100000;
+	static constexpr int PreloadSize = 8192;
+	static constexpr int BlockSize = 256;
+	static constexpr int NumSamplesToRender = 90000;
+
+	static void writeTestFile(const File& f)
+	{
+		AudioSampleBuffer b(2, NumSamplesInFile);
+		Random r(1234);
+
+		for (int i = 0; i < NumSamplesInFile; i++)
+		{
+			b.setSample(0, i, r.nextFloat() * 1.6f - 0.8f);
+			b.setSample(1, i, 0.5f * std::sin((float)i * 0.01f));
+		}
+
+		WavAudioFormat wav;
+		f.deleteFile();
+
+		ScopedPointer<AudioFormatWriter> writer = wav.createWriterFor(f.createOutputStream().release(), 44100.0, 2, 16, {}, 0);
+		writer->writeFromAudioSampleBuffer(b, 0, NumSamplesInFile);
+	}
+
+	static void prepareLoader(SampleLoader& l)
+	{
+		l.setIsNonRealtime(true);
+		l.setStreamingBufferDataType(true);
+	}
+
+	/** Advances all loaders block by block (the first loader always fills its segment first). */
+	static void renderInLockstep(Array<SampleLoader*> loaders, const StreamingSamplerSound* s, Array<AudioSampleBuffer*> results)
+	{
+		jassert(loaders.size() == results.size());
+
+		OwnedArray<hlac::HiseSampleBuffer> voiceBuffers;
+
+		for (int i = 0; i < loaders.size(); i++)
+		{
+			voiceBuffers.add(new hlac::HiseSampleBuffer(true, 2, BlockSize * 2));
+			results[i]->setSize(2, NumSamplesToRender);
+			loaders[i]->startNote(s, 0);
+		}
+
+		for (int pos = 0; pos + BlockSize <= NumSamplesToRender; pos += BlockSize)
+		{
+			for (int i = 0; i < loaders.size(); i++)
+			{
+				auto cd = loaders[i]->fillVoiceBuffer(*voiceBuffers[i], (double)BlockSize);
+
+				for (int c = 0; c < 2; c++)
+				{
+					auto src = static_cast<const float*>(cd.b->getReadPointer(c, cd.offsetInBuffer));
+					results[i]->copyFrom(c, pos, src, BlockSize);
+				}
+
+				loaders[i]->advanceReadIndex((double)(pos + BlockSize));
+			}
+		}
+	}
+
+	void expectMatch(const AudioSampleBuffer& expected, const AudioSampleBuffer& actual, const String& name)
+	{
+		for (int c = 0; c < 2; c++)
+		{
+			for (int i = 0; i < expected.getNumSamples(); i++)
+			{
+				if (expected.getSample(c, i) != actual.getSample(c, i))
+				{
+					expect(false, name + ": mismatch at sample " + String(i));
+					return;
+				}
+			}
+		}
+	}
+
+	void testTwoLoaders(const StreamingSamplerSound* s, const AudioSampleBuffer& reference)
+	{
+		beginTest("Two loaders match a single loader");
+
+		SampleThreadPool pool(nullptr);
+		SampleLoader a(&pool), b(&pool);
+		prepareLoader(a);
+		prepareLoader(b);
+
+		AudioSampleBuffer resultA, resultB;
+		renderInLockstep({ &a, &b }, s, { &resultA, &resultB });
+
+		expectMatch(reference, resultA, "first loader");
+		expectMatch(reference, resultB, "second loader");
+
+#if HISE_SAMPLER_SHARE_STREAMING_SEGMENTS
+		expect(pool.getSharedStreamSegments()->getNumCopiedSegments() > 0, "the second loader didn't copy any segment");
+#else
+		expectEquals(pool.getSharedStreamSegments()->getNumCopiedSegments(), 0, "sharing is disabled");
+#endif
+	}
+
+	void testInvalidationAfterRefill(const StreamingSamplerSound* s, const AudioSampleBuffer& reference)
+	{
+		beginTest("Segments are not shared after the owner has refilled its buffers");
+
+		SampleThreadPool pool(nullptr);
+		SampleLoader a(&pool), b(&pool);
+		prepareLoader(a);
+		prepareLoader(b);
+
+		// The first loader streams the entire sound, so it has refilled the buffers that contained
+		// the first segments. The late loader may only copy the last segments that are still valid.
+		AudioSampleBuffer resultA, resultB;
+		renderInLockstep({ &a }, s, { &resultA });
+		renderInLockstep({ &b }, s, { &resultB });
+
+		expectMatch(reference, resultB, "late loader");
+	}
+
+	void testInvalidationAfterClear(const StreamingSamplerSound* s, const AudioSampleBuffer& reference)
+	{
+		beginTest("Segments are not shared after the owner was cleared");
+
+		SampleThreadPool pool(nullptr);
+		SampleLoader a(&pool), b(&pool);
+		prepareLoader(a);
+		prepareLoader(b);
+
+		// publishes the first segment, then stops the voice
+		a.startNote(s, 0);
+		a.clearLoader();
+
+		AudioSampleBuffer resultB;
+		renderInLockstep({ &b }, s, { &resultB });
+
+		expectMatch(reference, resultB, "loader after clear");
+		expectEquals(pool.getSharedStreamSegments()->getNumCopiedSegments(), 0, "copied a cleared segment");
+	}
+
+	void testInvalidationAfterResize(const StreamingSamplerSound* s, const AudioSampleBuffer& reference)
+	{
+		beginTest("Segments are not shared after the owner has resized its buffers");
+
+		SampleThreadPool pool(nullptr);
+		SampleLoader a(&pool), b(&pool);
+		prepareLoader(a);
+		prepareLoader(b);
+
+		a.startNote(s, 0);
+
+		auto numSamples = (int)a.getActualStreamingBufferSize() / 4;
+		a.setBufferSize(numSamples * 2);
+
+		AudioSampleBuffer resultB;
+		renderInLockstep({ &b }, s, { &resultB });
+
+		expectMatch(reference, resultB, "loader after resize");
+		expectEquals(pool.getSharedStreamSegments()->getNumCopiedSegments(), 0, "copied a resized segment");
+	}
+
+	void testReleaseStateKey(const StreamingSamplerSound* s)
+	{
+		beginTest("The release state is part of the segment key");
+
+		SampleThreadPool pool(nullptr);
+		SampleLoader a(&pool), b(&pool);
+		prepareLoader(a);
+		prepareLoader(b);
+
+		a.startNote(s, 0);
+
+		auto numSamples = (int)a.getActualStreamingBufferSize() / 4;
+
+		SharedStreamSegments::Key k;
+		k.sound = s;
+		k.positionInSampleFile = s->getPreloadBuffer().getNumSamples();
+		k.numSamples = numSamples;
+		k.isFloat = true;
+
+		hlac::HiseSampleBuffer destination(true, 2, numSamples);
+		auto segments = pool.getSharedStreamSegments();
+
+#if HISE_SAMPLER_ALLOW_RELEASE_START
+		k.releaseState = StreamingSamplerSound::ReleasePlayState::Playing;
+		expect(!segments->copySegment(k, &b, destination), "copied a segment with another release state");
+#endif
+
+		k.releaseState = StreamingSamplerSound::ReleasePlayState::Inactive;
+
+#if HISE_SAMPLER_SHARE_STREAMING_SEGMENTS
+		expect(segments->copySegment(k, &b, destination), "the segment wasn't published");
+#else
+		expect(!segments->copySegment(k, &b, destination), "sharing is disabled");
+#endif
+	}
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SharedStreamSegmentsTests);
+};
+
+static SharedStreamSegmentsTests sharedStreamSegmentsTests;
+
+} // namespace hise
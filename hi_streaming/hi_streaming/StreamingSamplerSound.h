@@ -303,6 +303,7 @@ public:
 	int64 getMonolithOffset() const { return fileReader.getMonolithOffset(); }
 	int64 getMonolithLength() const { return fileReader.getMonolithLength(); }
 	double getMonolithSampleRate() const { return fileReader.getMonolithSampleRate(); }
+	File getMonolithFile() const { return fileReader.getMonolithFile(); }
 
 	// ==============================================================================================================================================
 
@@ -443,6 +444,14 @@ private:
 			return 0;
 		}
 
+		File getMonolithFile() const
+		{
+			if (monolithicInfo != nullptr)
+				return monolithicInfo->getFile(monolithicChannelIndex, monolithicIndex);
+
+			return {};
+		}
+
 		int64 getMonolithLength() const
 		{
 			if (monolithicInfo != nullptr)
@@ -32,6 +32,90 @@
 
 namespace hise { using namespace juce;
 
+// =============================================================================================================================================== SharedStreamSegments methods
+
+bool SharedStreamSegments::Key::operator==(const Key& other) const
+{
+	return sound == other.sound &&
+		   positionInSampleFile == other.positionInSampleFile &&
+		   numSamples == other.numSamples &&
+		   isFloat == other.isFloat &&
+		   releaseState == other.releaseState;
+}
+
+bool SharedStreamSegments::copySegment(const Key& k, const SampleLoader* requestingLoader, hlac::HiseSampleBuffer& destination)
+{
+	ScopedLock sl(lock);
+
+	for (const auto& s : segments)
+	{
+		if (s.owner == requestingLoader || !(s.key == k))
+			continue;
+
+		// The owner is resizing its buffers
+		ScopedTryLock stl(s.owner->getLock());
+
+		if (!stl.isLocked())
+			return false;
+
+		auto& version = s.owner->getBufferVersion(s.buffer);
+
+		if (version.load() != s.version)
+			continue;
+
+		destination.clearNormalisation({});
+		destination.setUseOneMap(s.buffer->useOneMap);
+		destination.getNormaliseMap(0).setOffset(s.buffer->getNormaliseMap(0).getOffset());
+
+		if (!s.buffer->useOneMap)
+			destination.getNormaliseMap(1).setOffset(s.buffer->getNormaliseMap(1).getOffset());
+
+		hlac::HiseSampleBuffer::copy(destination, *s.buffer, 0, 0, k.numSamples);
+
+		// The owner has started to refill the buffer while we were copying
+		if (version.load() != s.version)
+			return false;
+
+		++numCopiedSegments;
+		return true;
+	}
+
+	return false;
+}
+
+void SharedStreamSegments::publish(const Key& k, SampleLoader* owner, const hlac::HiseSampleBuffer* buffer, uint32 version)
+{
+	ScopedLock sl(lock);
+
+	Segment newSegment;
+	newSegment.key = k;
+	newSegment.owner = owner;
+	newSegment.buffer = buffer;
+	newSegment.version = version;
+
+	for (auto& s : segments)
+	{
+		if (s.owner == owner && s.buffer == buffer)
+		{
+			s = newSegment;
+			return;
+		}
+	}
+
+	segments.add(newSegment);
+}
+
+void SharedStreamSegments::removeLoader(const SampleLoader* owner)
+{
+	ScopedLock sl(lock);
+
+	for (int i = 0; i < segments.size(); i++)
+	{
+		if (segments.getReference(i).owner == owner)
+			segments.remove(i--);
+	}
+}
+
 // =============================================================================================================================================== SampleLoader methods
 
 
@@ -57,11 +141,17 @@ SampleLoader::SampleLoader(SampleThreadPool *pool_) :
 {
 	unmapper.setLoader(this);
 
+	if (backgroundPool != nullptr)
+		sharedSegments = backgroundPool->getSharedStreamSegments();
+
 	setBufferSize(BUFFER_SIZE_FOR_STREAM_BUFFERS);
 }
 
 SampleLoader::~SampleLoader()
 {
+	if (sharedSegments != nullptr)
+		sharedSegments->removeLoader(this);
+
 	b1.setSize(2, 0);
 	b2.setSize(2, 0);
 }
@@ -84,6 +174,8 @@ void SampleLoader::setBufferSize(int newBufferSize)
 
 bool SampleLoader::assertBufferSize(int minimumBufferSize)
 {
+	ScopedLock sl(getLock());
+
 	minimumBufferSizeForSamplesPerBlock = minimumBufferSize;
 
 	refreshBufferSizes();
@@ -187,9 +279,14 @@ NotificationType SampleLoader::waitForTimestretchSeek(StreamingSamplerVoice* v)
 
 void SampleLoader::clearLoader()
 {
+	// The sound might be deleted after the voice was stopped
+	invalidateSharedSegment(&b1);
+	invalidateSharedSegment(&b2);
+
 	sound = nullptr;
 	diskUsage = 0.0f;
 	cancelled = true;
+	groupRequestPending.store(false);
 	resetJob();
 }
 
@@ -206,6 +303,9 @@ void SampleLoader::setStreamingBufferDataType(bool shouldBeFloat)
 	{
 		ScopedLock sl(getLock());
 
+		invalidateSharedSegment(&b1);
+		invalidateSharedSegment(&b2);
+
 		b1 = hlac::HiseSampleBuffer(shouldBeFloat, 2, 0);
 		b2 = hlac::HiseSampleBuffer(shouldBeFloat, 2, 0);
 
@@ -430,9 +530,13 @@ bool SampleLoader::requestNewData()
 		return true;
 	}
 
+	if (group != nullptr)
+		return group->requestNewData(this);
+
 #if KILL_VOICES_WHEN_STREAMING_IS_BLOCKED
 	if (this->isQueued() && !isWaitingForTimestretchSeek())
 	{
+		invalidateSharedSegment(writeBuffer.get());
 		writeBuffer.get()->clear();
 
 		cancelled = true;
@@ -451,6 +555,69 @@ bool SampleLoader::requestNewData()
 };
 
 
+SampleLoaderGroup::SampleLoaderGroup(SampleThreadPool* pool_) :
+	SampleThreadPoolJob("SampleLoaderGroup"),
+	pool(pool_)
+{}
+
+void SampleLoaderGroup::addLoader(SampleLoader* l)
+{
+	jassert(l->group == nullptr);
+	l->group = this;
+	loaders.add(l);
+}
+
+bool SampleLoaderGroup::requestNewData(SampleLoader* l)
+{
+#if KILL_VOICES_WHEN_STREAMING_IS_BLOCKED
+	if (l->groupRequestPending.load() && !l->isWaitingForTimestretchSeek())
+	{
+		l->invalidateSharedSegment(l->writeBuffer.get());
+		l->writeBuffer.get()->clear();
+
+		l->cancelled = true;
+		pool->notify();
+		return false;
+	}
+#endif
+
+	l->groupRequestPending.store(true);
+
+	// Only the first request after the group has drained its list adds the job,
+	// the others are picked up by the job that is already queued or running.
+	if (pendingRequests.fetch_add(1) == 0)
+		pool->addJob(this, false);
+
+	return true;
+}
+
+SampleThreadPoolJob::JobStatus SampleLoaderGroup::runJob()
+{
+	for (;;)
+	{
+		auto numRequests = pendingRequests.load();
+		auto needsRunningAgain = false;
+
+		for (auto l : loaders)
+		{
+			if (l->groupRequestPending.exchange(false))
+			{
+				if (l->runJob() == SampleThreadPoolJob::jobNeedsRunningAgain)
+				{
+					l->groupRequestPending.store(true);
+					needsRunningAgain = true;
+				}
+			}
+		}
+
+		if (needsRunningAgain)
+			return SampleThreadPoolJob::jobNeedsRunningAgain;
+
+		if (pendingRequests.compare_exchange_strong(numRequests, 0))
+			return SampleThreadPoolJob::jobHasFinished;
+	}
+}
+
 SampleThreadPoolJob::JobStatus SampleLoader::runJob()
 {
 	if(isWaitingForTimestretchSeek())
@@ -518,6 +685,26 @@ void SampleLoader::fillInactiveBuffer()
 
 	if (localSound != nullptr)
 	{
+		auto localWriteBuffer = writeBuffer.get();
+
+		invalidateSharedSegment(localWriteBuffer);
+
+#if HISE_SAMPLER_SHARE_STREAMING_SEGMENTS
+		const auto version = getBufferVersion(localWriteBuffer).load();
+
+		SharedStreamSegments::Key k;
+		k.sound = localSound;
+		k.positionInSampleFile = positionInSampleFile;
+		k.numSamples = getNumSamplesForStreamingBuffers();
+		k.isFloat = localWriteBuffer->isFloatingPoint();
+		k.releaseState = getReleasePlayState();
+
+		if (sharedSegments != nullptr && sharedSegments->copySegment(k, this, *localWriteBuffer))
+		{
+			// another voice has already decoded this segment
+		}
+		else
+#endif
 		if (localSound->hasEnoughSamplesForBlock(positionInSampleFile + getNumSamplesForStreamingBuffers()))
 		{
 			localSound->fillSampleBuffer(*writeBuffer.get(), getNumSamplesForStreamingBuffers(), (int)positionInSampleFile, getReleasePlayState());
@@ -536,6 +723,11 @@ void SampleLoader::fillInactiveBuffer()
 			writeBuffer.get()->clear();
 		}
 
+#if HISE_SAMPLER_SHARE_STREAMING_SEGMENTS
+		if (sharedSegments != nullptr)
+			sharedSegments->publish(k, this, localWriteBuffer, version);
+#endif
+
 #if LOG_SAMPLE_RENDERING
 		logger->checkAssertion(nullptr, DebugLogger::Location::SampleLoaderReadOperation, localSound != nullptr, 1174);
 #endif
@@ -570,6 +762,9 @@ void SampleLoader::refreshBufferSizes()
 
 	if (getNumSamplesForStreamingBuffers() < numSamplesToUse)
 	{
+		invalidateSharedSegment(&b1);
+		invalidateSharedSegment(&b2);
+
 		StreamingHelpers::increaseBufferIfNeeded(b1, numSamplesToUse);
 		StreamingHelpers::increaseBufferIfNeeded(b2, numSamplesToUse);
 
@@ -580,6 +775,18 @@ void SampleLoader::refreshBufferSizes()
 	}
 }
 
+std::atomic<uint32>& SampleLoader::getBufferVersion(const hlac::HiseSampleBuffer* b)
+{
+	// the write buffer is always one of the streaming buffers
+	jassert(b == &b1 || b == &b2);
+	return b == &b1 ? b1Version : b2Version;
+}
+
+void SampleLoader::invalidateSharedSegment(const hlac::HiseSampleBuffer* b)
+{
+	getBufferVersion(b)++;
+}
+
 bool SampleLoader::swapBuffers()
 {
 	auto localReadBuffer = readBuffer.get();
@@ -893,6 +1100,95 @@ template <typename SignalType, bool isFloat> void interpolateStereoSamples(const
 	}
 }
 
+template <typename SignalType, bool isFloat> void interpolateFusedPairs(const StreamingSamplerVoice::FusedChannelPair* pairs, int numPairs, const int* positions, const float* alphas, int offset, int numSamples)
+{
+	constexpr float gainFactor = isFloat ? 1.0f : (1.0f / (float)INT16_MAX);
+
+	for (int p = 0; p < numPairs; p++)
+	{
+		const auto& pair = pairs[p];
+
+		if (pair.isFloat != isFloat)
+			continue;
+
+		// The read positions are increasing, so we can skip the samples at the end instead of checking each position
+		int numValid = numSamples;
+
+		while (numValid > 0 && positions[numValid - 1] >= pair.maxIndexInBuffer)
+			numValid--;
+
+		auto inL = static_cast<const SignalType*>(pair.inL);
+		auto inR = static_cast<const SignalType*>(pair.inR);
+		auto outL = pair.outL + offset;
+		auto outR = pair.outR + offset;
+
+		for (int i = 0; i < numValid; i++)
+		{
+			const int pos = positions[i];
+			const float alpha = alphas[i];
+
+			outL[i] = Interpolator::interpolateLinear((float)inL[pos], (float)inL[pos + 1], alpha) * gainFactor;
+			outR[i] = Interpolator::interpolateLinear((float)inR[pos], (float)inR[pos + 1], alpha) * gainFactor;
+		}
+	}
+}
+
+void StreamingSamplerVoice::interpolateFused(const FusedChannelPair* pairs, int numPairs, const float* pitchData, int startSample, double startAlpha, double uptimeDelta, int numSamples)
+{
+	// Small enough to stay in the L1 cache while it's applied to all channel pairs
+	constexpr int ChunkSize = 64;
+
+	int positions[ChunkSize];
+	float alphas[ChunkSize];
+
+	bool hasFloatPairs = false;
+	bool hasIntPairs = false;
+
+	for (int i = 0; i < numPairs; i++)
+	{
+		hasFloatPairs |= pairs[i].isFloat;
+		hasIntPairs |= !pairs[i].isFloat;
+	}
+
+	// This must yield the exact same positions as interpolateStereoSamples()
+	float indexInBufferFloat = (float)startAlpha;
+	const float uptimeDeltaFloat = (float)uptimeDelta;
+
+	if (pitchData != nullptr)
+		pitchData += startSample;
+
+	for (int offset = 0; offset < numSamples; offset += ChunkSize)
+	{
+		const int numThisTime = jmin(ChunkSize, numSamples - offset);
+
+		if (pitchData != nullptr)
+		{
+			for (int i = 0; i < numThisTime; i++)
+			{
+				const int pos = int(indexInBufferFloat);
+				positions[i] = pos;
+				alphas[i] = indexInBufferFloat - (float)pos;
+				indexInBufferFloat += pitchData[offset + i];
+			}
+		}
+		else
+		{
+			for (int i = 0; i < numThisTime; i++)
+			{
+				const int pos = int(indexInBufferFloat);
+				positions[i] = pos;
+				alphas[i] = indexInBufferFloat - (float)pos;
+				indexInBufferFloat += uptimeDeltaFloat;
+			}
+		}
+
+		if (hasFloatPairs)
+			interpolateFusedPairs<float, true>(pairs, numPairs, positions, alphas, offset, numThisTime);
+
+		if (hasIntPairs)
+			interpolateFusedPairs<int16, false>(pairs, numPairs, positions, alphas, offset, numThisTime);
+	}
+}
 
 void StreamingSamplerVoice::interpolateFromStereoData(int startSample, float* outL, float* outR, int numSamplesToCalculate, const float* pitchDataToUse, double thisUptimeDelta, const double startAlpha, StereoChannelData data, int samplesAvailable)
 {
@@ -1186,38 +1482,107 @@ void StreamingSamplerVoice::renderNextBlock(AudioSampleBuffer &outputBuffer, int
                 FloatVectorOperations::copy(out[1], out[0], numOutput);
 		}
 
-		if (!loader.advanceReadIndex(voiceUptime))
-		{
+		advanceAfterRendering(sound, outputBuffer, startFixed, numSamplesFixed);
+	}
+	else
+	{
+		resetVoice();
+	}
+};
+
+void StreamingSamplerVoice::advanceAfterRendering(const StreamingSamplerSound* sound, AudioSampleBuffer& outputBuffer, int startSample, int numSamples)
+{
+	if (!loader.advanceReadIndex(voiceUptime))
+	{
 #if LOG_SAMPLE_RENDERING
-			logger->addStreamingFailure(voiceUptime);
+		logger->addStreamingFailure(voiceUptime);
 #endif
 
-			outputBuffer.clear(startFixed, numSamplesFixed);
+		outputBuffer.clear(startSample, numSamples);
 
-			resetVoice();
-			return;
-		}
+		resetVoice();
+		return;
+	}
 
-		bool enoughSamples = sound->hasEnoughSamplesForBlock((int)(voiceUptime));// +numSamples * MAX_SAMPLER_PITCH));
+	bool enoughSamples = sound->hasEnoughSamplesForBlock((int)(voiceUptime));// +numSamples * MAX_SAMPLER_PITCH));
 
 #if HISE_SAMPLER_ALLOW_RELEASE_START
-		if(loader.getReleasePlayState() == StreamingSamplerSound::ReleasePlayState::Playing && voiceUptime > sound->getSampleLength())
-			enoughSamples = false;
+	if(loader.getReleasePlayState() == StreamingSamplerSound::ReleasePlayState::Playing && voiceUptime > sound->getSampleLength())
+		enoughSamples = false;
 #endif
 
-
 #if LOG_SAMPLE_RENDERING
-		logger->checkSampleData(nullptr, DebugLogger::Location::SampleVoiceBufferFillPost, true, outputBuffer.getReadPointer(0, startFixed), numSamplesFixed);
-		logger->checkSampleData(nullptr, DebugLogger::Location::SampleVoiceBufferFillPost, false, outputBuffer.getReadPointer(1, startFixed), numSamplesFixed);
+	logger->checkSampleData(nullptr, DebugLogger::Location::SampleVoiceBufferFillPost, true, outputBuffer.getReadPointer(0, startSample), numSamples);
+	logger->checkSampleData(nullptr, DebugLogger::Location::SampleVoiceBufferFillPost, false, outputBuffer.getReadPointer(1, startSample), numSamples);
 #endif
 
-		if (!enoughSamples) resetVoice();
-	}
+	if (!enoughSamples) resetVoice();
+}
+
+bool StreamingSamplerVoice::prepareFusedBlock(float* outL, float* outR, FusedChannelPair& pair)
+{
+#if USE_CUBIC_INTERPOLATION || USE_SAMPLE_DEBUG_COUNTER
+	ignoreUnused(outL, outR, pair);
+	return false;
+#else
+	const StreamingSamplerSound* sound = loader.getLoadedSound();
+
+	// The delayed start and the timestretcher change the read positions of each voice
+	if (sound == nullptr || voiceUptime < 0.0 || stretcher.isEnabled())
+		return false;
+
+#if HISE_SAMPLER_ALLOW_RELEASE_START
+	if (jumpToReleaseOnNextRender || releaseFadeCounter > 0)
+		return false;
+#endif
+
+	const double startAlpha = getStartAlpha();
+
+	auto tempVoiceBuffer = getTemporaryVoiceBuffer();
+
+	if (!isPositiveAndBelow(pitchCounter + startAlpha, (double)tempVoiceBuffer->getNumSamples()))
+		return false;
+
+	StereoChannelData data = loader.fillVoiceBuffer(*tempVoiceBuffer, pitchCounter + startAlpha);
+
+	// The temporary buffer is shared between all voices, so we can only use 
+	// the data if it points directly to the streaming buffers.
+	if (data.b == tempVoiceBuffer)
+		return false;
+
+	if (!data.b->isFloatingPoint() && data.b->usesNormalisation())
+		return false;
+
+	const int samplesAvailable = data.b->getNumSamples() - data.offsetInBuffer;
+
+	pair.inL = data.b->getReadPointer(0, data.offsetInBuffer);
+	pair.inR = data.b->getReadPointer(1, data.offsetInBuffer);
+	pair.outL = outL;
+	pair.outR = outR;
+	pair.isFloat = data.b->isFloatingPoint();
+	pair.maxIndexInBuffer = (int)(startAlpha + samplesAvailable);
+
+	return true;
+#endif
+}
+
+void StreamingSamplerVoice::finishFusedBlock(AudioSampleBuffer& outputBuffer, int startSample, int numSamples)
+{
+	const StreamingSamplerSound* sound = loader.getLoadedSound();
+
+	jassert(sound != nullptr);
+
+#if HISE_SAMPLER_ALLOW_RELEASE_START
+	if (releaseGain != 1.0f)
+		outputBuffer.applyGain(startSample, numSamples, releaseGain);
 	else
-	{
-		resetVoice();
-	}
-};
+		sound->calculateReleasePeak(outputBuffer.getWritePointer(0, startSample), numSamples);
+#endif
+
+	voiceUptime += pitchCounter;
+
+	advanceAfterRendering(sound, outputBuffer, startSample, numSamples);
+}
 
 void StreamingSamplerVoice::setPitchFactor(int midiNote, int rootNote, StreamingSamplerSound *sound, double globalPitchFactor)
 {
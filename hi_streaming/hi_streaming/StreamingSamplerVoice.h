@@ -36,6 +36,73 @@
 namespace hise { using namespace juce;
 
 class StreamingSamplerVoice;
+class SampleLoader;
+class SampleLoaderGroup;
+
+/** A registry of decoded streaming segments that allows voices which play the same sound to share the disk reads.
+*
+*	The SampleLoaders read the file in chunks of the streaming buffer size that start right after the preload buffer,
+*	so voices that play the same sound (eg. unison voices or stacked layers) request the exact same segments no matter
+*	where they started. Whenever a loader has decoded a segment, it publishes its buffer here and the other loaders copy
+*	the decoded data instead of reading it from the disk again. Each voice keeps its own read index, so they can still
+*	be played back with different pitch factors.
+*
+*	The segments are copied and published on the sample loading thread (or the audio thread if the loader is rendering in
+*	non-realtime mode). A published segment becomes invalid as soon as its owner writes into the buffer again, so this
+*	will only work for voices that are less than one streaming buffer apart.
+*/
+class SharedStreamSegments : public ReferenceCountedObject
+{
+public:
+
+	using Ptr = ReferenceCountedObjectPtr<SharedStreamSegments>;
+
+	/** The properties that identify a decoded segment. */
+	struct Key
+	{
+		bool operator==(const Key& other) const;
+
+		const StreamingSamplerSound* sound = nullptr;
+		int positionInSampleFile = -1;
+		int numSamples = 0;
+		bool isFloat = true;
+		StreamingSamplerSound::ReleasePlayState releaseState = StreamingSamplerSound::ReleasePlayState::Inactive;
+	};
+
+	/** Copies the segment into the buffer if another loader has decoded it. 
+	*
+	*	@return 'true' if the segment was found and copied, 'false' if the loader needs to read it from the disk.
+	*/
+	bool copySegment(const Key& k, const SampleLoader* requestingLoader, hlac::HiseSampleBuffer& destination);
+
+	/** Publishes the segment that the owner has just decoded into the given buffer.
+	*
+	*	Pass in the buffer version from before the read operation so that the segment is discarded if the loader was reset in the meantime.
+	*/
+	void publish(const Key& k, SampleLoader* owner, const hlac::HiseSampleBuffer* buffer, uint32 version);
+
+	/** Removes all segments of the given loader. */
+	void removeLoader(const SampleLoader* owner);
+
+	/** Returns the amount of segments that were copied instead of being read from the disk. */
+	int getNumCopiedSegments() const noexcept { return numCopiedSegments.load(); }
+
+private:
+
+	struct Segment
+	{
+		Key key;
+		SampleLoader* owner = nullptr;
+		const hlac::HiseSampleBuffer* buffer = nullptr;
+		uint32 version = 0;
+	};
+
+	CriticalSection lock;
+	Array<Segment> segments;
+	std::atomic<int> numCopiedSegments = { 0 };
+
+	JUCE_DECLARE_NON_COPYABLE(SharedStreamSegments);
+};
 
 /** This is a utility class that handles buffered sample streaming in a background thread.
 *
@@ -177,6 +244,11 @@ private:
 	bool nonRealtime = false;
 
 	friend class Unmapper;
+	friend class SharedStreamSegments;
+	friend class SampleLoaderGroup;
+
+	SampleLoaderGroup* group = nullptr;
+	std::atomic<bool> groupRequestPending = { false };
 
 	// ============================================================================================ internal methods
 
@@ -192,6 +264,12 @@ private:
 
 	void fillInactiveBuffer();
 	void refreshBufferSizes();
+
+	/** Returns the version counter of the given streaming buffer. */
+	std::atomic<uint32>& getBufferVersion(const hlac::HiseSampleBuffer* b);
+
+	/** Invalidates the published segments of the given buffer. Call this before you change its content. */
+	void invalidateSharedSegment(const hlac::HiseSampleBuffer* b);
 	// ============================================================================================ member variables
 
 	Unmapper unmapper;
@@ -244,10 +322,49 @@ private:
 
 	hlac::HiseSampleBuffer b1, b2;
 
+	// incremented whenever the content of b1 / b2 changes
+	std::atomic<uint32> b1Version = { 0 };
+	std::atomic<uint32> b2Version = { 0 };
+
+	SharedStreamSegments::Ptr sharedSegments;
+
 	bool cancelled = false;
 };
 
 
+/** Bundles the streaming requests of multiple SampleLoaders into a single background job.
+*
+*	The mic positions of a multimic sample are played back with the same pitch and position, so their loaders
+*	run out of data at the same time. Instead of adding one job per mic position to the SampleThreadPool, the 
+*	loaders of a group mark themselves as pending and the group refills all pending loaders in one job.
+*/
+class SampleLoaderGroup : public SampleThreadPoolJob
+{
+public:
+
+	SampleLoaderGroup(SampleThreadPool* pool_);
+
+	/** Adds the loader to this group. Call this before the loader is used. */
+	void addLoader(SampleLoader* l);
+
+	/** Refills all pending loaders. */
+	JobStatus runJob() override;
+
+private:
+
+	friend class SampleLoader;
+
+	/** Called by a loader of this group instead of adding itself to the pool. */
+	bool requestNewData(SampleLoader* l);
+
+	SampleThreadPool* pool;
+	Array<SampleLoader*> loaders;
+
+	std::atomic<int> pendingRequests = { 0 };
+
+	JUCE_DECLARE_NON_COPYABLE(SampleLoaderGroup);
+};
+
 /** A SamplerVoice that streams the data from a StreamingSamplerSound
 *
 *	It uses a SampleLoader object to fetch the data and copies the values into an internal buffer, so you
@@ -283,6 +400,40 @@ public:
 	/** Adds it's output to the outputBuffer. */
 	void renderNextBlock(AudioSampleBuffer &outputBuffer, int startSample, int numSamples) override;
 
+	/** The source and target of a channel pair that is interpolated with interpolateFused(). */
+	struct FusedChannelPair
+	{
+		const void* inL = nullptr;
+		const void* inR = nullptr;
+		float* outL = nullptr;
+		float* outR = nullptr;
+		bool isFloat = true;
+		int maxIndexInBuffer = 0;
+	};
+
+	/** Prepares the rendering of the next block without interpolating the samples. 
+	*
+	*	If multiple voices play back with the same pitch and position (eg. the mic positions of a multimic sample), you can
+	*	call this for every voice, interpolate all channel pairs with interpolateFused() and then call finishFusedBlock().
+	*	Returns false if the voice can't be rendered this way (eg. because of timestretching or a release fade) - 
+	*	in this case, nothing was changed and you need to call renderNextBlock() instead.
+	*/
+	bool prepareFusedBlock(float* outL, float* outR, FusedChannelPair& pair);
+
+	/** Advances the voice after its channel pair was interpolated with interpolateFused(). */
+	void finishFusedBlock(AudioSampleBuffer& outputBuffer, int startSample, int numSamples);
+
+	/** Interpolates multiple channel pairs with the same read positions in one pass.
+	*
+	*	The read index and alpha are calculated once for a chunk of samples and then applied to all channel pairs
+	*	while they are still in the cache.
+	*/
+	static void interpolateFused(const FusedChannelPair* pairs, int numPairs, const float* pitchData, int startSample, 
+	                             double startAlpha, double uptimeDelta, int numSamples);
+
+	/** Returns the start alpha of the next block. */
+	double getStartAlpha() const { return fmod(voiceUptime, 1.0); }
+
 	/** You can pass a pointer with float values containing pitch information for each sample and the delta pitch value for each sample.
 	*
 	*	The array size should be exactly the number of samples that are calculated in the current renderNextBlock method.
@@ -435,6 +586,8 @@ private:
 
 	double pitchCounter = 0.0;
 
+	void advanceAfterRendering(const StreamingSamplerSound* sound, AudioSampleBuffer& outputBuffer, int startSample, int numSamples);
+
 	hlac::HiseSampleBuffer* tvb = nullptr;
 	AudioSampleBuffer* stretchBuffer = nullptr;
 
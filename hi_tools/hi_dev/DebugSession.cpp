@@ -1023,6 +1023,9 @@ void DebugSession::ProfileDataSource::ProfileInfoBase::optimize()
 
 void DebugSession::startScopedProfile(ProfileDataSource::Ptr newParent)
 {
+	if(auto so = scopeObserver.load())
+		so->onScopeStart(newParent.get());
+
 	auto t = getCurrentThreadIdentifier();
 
 	if(t.threadId == nullptr)
@@ -1050,6 +1053,9 @@ void DebugSession::startScopedProfile(ProfileDataSource::Ptr newParent)
 
 void DebugSession::pushProfileInfo(ProfileDataSource::Ptr dataToPop)
 {
+	if(auto so = scopeObserver.load())
+		so->onScopeEnd(dataToPop.get());
+
 	auto t = getCurrentThreadIdentifier();
 
 	if(t.threadId == nullptr)
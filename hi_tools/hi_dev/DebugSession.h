@@ -619,6 +619,22 @@ public:
 	void startScopedProfile(ProfileDataSource::Ptr newParent);
 	void pushProfileInfo(ProfileDataSource::Ptr dataToPop);
 
+	/** A lightweight observer that gets notified about every profile scope without going through the recording queue.
+	 *
+	 *  This is used by offline tools (eg. the benchmark command line action) that want to accumulate the
+	 *  timings of the existing profile scopes without having to start a recording session. The callbacks
+	 *  are executed synchronously on the thread that enters / leaves the scope, so keep them cheap.
+	 */
+	struct ScopeObserver
+	{
+		virtual ~ScopeObserver() {};
+
+		virtual void onScopeStart(ProfileDataSource* source) = 0;
+		virtual void onScopeEnd(ProfileDataSource* source) = 0;
+	};
+
+	void setScopeObserver(ScopeObserver* newObserver) { scopeObserver.store(newObserver); }
+
 	DebugInformationBase::Ptr getLastProfileRoot(ThreadIdentifier::Type) const;
 
 	void startRecording(double milliSeconds, ApiProviderBase::Holder* h);
@@ -924,6 +940,7 @@ private:
 
 	std::atomic<RecordingState> nextState { RecordingState::Idle };
 	WeakReference<ApiProviderBase::Holder> recordHolder;
+	std::atomic<ScopeObserver*> scopeObserver { nullptr };
 	double recordingStart= 0.0;
 	double recordingDelta = 0.0;
 
@@ -114,6 +114,31 @@ public:
 	void setEnableProfiling(bool, void*, bool) {};
 };
 
+#if HISE_INCLUDE_LIGHTWEIGHT_TRACER
+class DummyProfiledProcessor: public LightweightTracer::NameProvider
+{
+public:
+
+	struct Profiler: public LightweightTracer::ScopedTrace
+	{
+		Profiler(DummyProfiledProcessor& p, int index):
+		  ScopedTrace(&p, index)
+		{};
+	};
+
+	DummyProfiledProcessor()
+	{
+		LightweightTracer::getInstance().registerNameProvider(this, this);
+	}
+
+	virtual ~DummyProfiledProcessor()
+	{
+		LightweightTracer::getInstance().unregisterNameProvider(this);
+	};
+
+	/** Override this and return a descriptive name for the profile scope index. */
+	String getTraceScopeName(int scopeIndex) const override { return "Scope " + String(scopeIndex); }
+#else
 class DummyProfiledProcessor
 {
 public:
@@ -124,6 +149,7 @@ public:
 	};
 
 	virtual ~DummyProfiledProcessor() {};
+#endif
 	virtual void onProfileEnableChange() {}
 	virtual double getBufferDuration() const { return 0.0; }
 	void setEnableProfiling(bool) {};
@@ -303,16 +303,134 @@ void SimpleRingBuffer::write(const AudioSampleBuffer& b, int startSample, int nu
 
 void SimpleRingBuffer::onComplexDataEvent(ComplexDataUIUpdaterBase::EventType t, var n)
 {
+	// This is our own refresh message after the background transformation
+	if (sendingTransformRefresh)
+		return;
+
 	if(t == ComplexDataUIUpdaterBase::EventType::ContentRedirected)
 		setupReadBuffer(externalBuffer);
 	else
 	{
-        ScopedLock sl(getReadBufferLock());
+		if (transformsOnBackgroundThread())
+		{
+			if (transformNotifier == nullptr)
+				transformNotifier = new TransformNotifier(*this, getUpdater().getGlobalUIUpdater());
+
+			// If there's already a pending transformation, it will pick up the latest data
+			if (!transformPending.exchange(true))
+				backgroundTransformer->addBuffer(this);
+
+			return;
+		}
+
+		readAndTransform();
+	}
+}
+
+bool SimpleRingBuffer::transformsOnBackgroundThread() const
+{
+	return properties != nullptr && properties->transformOnBackgroundThread() && getReferenceCount() > 1;
+}
+
+SimpleRingBuffer::TransformNotifier::TransformNotifier(SimpleRingBuffer& parent_, PooledUIUpdater* updater) :
+	SimpleTimer(updater, updater != nullptr),
+	parent(parent_)
+{}
+
+SimpleRingBuffer::TransformNotifier::~TransformNotifier()
+{
+	cancelPendingUpdate();
+}
+
+void SimpleRingBuffer::TransformNotifier::timerCallback()
+{
+	if (dirty.exchange(false))
+		sendRefresh();
+}
+
+void SimpleRingBuffer::TransformNotifier::handleAsyncUpdate()
+{
+	dirty.store(false);
+	sendRefresh();
+}
+
+void SimpleRingBuffer::TransformNotifier::trigger()
+{
+	dirty.store(true);
+
+	// Without a pooled updater we need to use the message queue
+	if (!isTimerRunning())
+		triggerAsyncUpdate();
+}
+
+void SimpleRingBuffer::TransformNotifier::sendRefresh()
+{
+	ScopedValueSetter<bool> svs(parent.sendingTransformRefresh, true);
+
+	// Repeat the last display index: a content message would make the data listeners 
+	// (eg. the scriptnode data slots) update their state for every frame
+	auto& u = parent.getUpdater();
+	u.sendDisplayChangeMessage(u.getLastDisplayValue(), sendNotificationSync, true);
+}
+
+void SimpleRingBuffer::readAndTransform()
+{
+	ScopedLock sl(getReadBufferLock());
         
-		read(externalBuffer);
+	read(externalBuffer);
+
+	if (properties != nullptr && getReferenceCount() > 1)
+		properties->transformReadBuffer(externalBuffer);
+}
+
+SimpleRingBuffer::BackgroundTransformer::BackgroundTransformer() :
+	Thread("Ring Buffer Transformer")
+{}
+
+SimpleRingBuffer::BackgroundTransformer::~BackgroundTransformer()
+{
+	stopThread(1000);
+}
 
-		if (properties != nullptr && getReferenceCount() > 1)
-			properties->transformReadBuffer(externalBuffer);
+void SimpleRingBuffer::BackgroundTransformer::addBuffer(SimpleRingBuffer* rb)
+{
+	{
+		ScopedLock sl(queueLock);
+		pendingBuffers.add(rb);
+	}
+
+	if (!isThreadRunning())
+		startThread();
+
+	notify();
+}
+
+void SimpleRingBuffer::BackgroundTransformer::run()
+{
+	while (!threadShouldExit())
+	{
+		ReferenceCountedArray<SimpleRingBuffer> buffers;
+
+		{
+			ScopedLock sl(queueLock);
+			buffers.swapWith(pendingBuffers);
+		}
+
+		for (auto rb : buffers)
+		{
+			rb->transformPending.store(false);
+			rb->readAndTransform();
+
+			// The notifier is created before the buffer is added to the queue
+			rb->transformNotifier->trigger();
+		}
+
+		// Another thread might drop its reference at any time, so the buffers
+		// must always be released on the message thread
+		if (!buffers.isEmpty())
+			MessageManager::callAsync([releasedBuffers = std::move(buffers)]() { ignoreUnused(releasedBuffers); });
+
+		wait(-1);
 	}
 }
 
@@ -344,7 +462,10 @@ void SimpleRingBuffer::setPropertyObject(PropertyObject* newObject)
 	jassertfalse;
 #endif
 
-	properties = newObject;
+	{
+		ScopedLock sl(getReadBufferLock());
+		properties = newObject;
+	}
 
 	properties->initialiseRingBuffer(this);
 
@@ -450,6 +571,11 @@ int ModPlotter::getSamplesPerPixel(float rectangleWidth) const
 
 void RingBufferComponentBase::onComplexDataEvent(ComplexDataUIUpdaterBase::EventType e, var newValue)
 {
+	// The read buffer isn't transformed yet, the ring buffer will send a refresh when it's done
+	if (rb != nullptr && e != ComplexDataUIUpdaterBase::EventType::ContentRedirected &&
+		rb->transformsOnBackgroundThread() && !rb->isSendingTransformRefresh())
+		return;
+
 	SafeAsyncCall::callAsyncIfNotOnMessageThread<RingBufferComponentBase>(*this, [](RingBufferComponentBase& c)
 	{
 		c.refresh();
@@ -119,6 +119,14 @@ struct SimpleRingBuffer: public ComplexDataUIBase,
 
 		virtual void transformReadBuffer(AudioSampleBuffer& b);
 
+		/** Override this and return true if the transformation is expensive and can be executed on a background thread.
+
+			If this is enabled, the ring buffer will be read and transformed on a shared background thread so that
+			the message thread only needs to draw the result (this implies that transformReadBuffer() and 
+			setProperty() must not be called concurrently, so lock the read buffer lock in setProperty()).
+		*/
+		virtual bool transformOnBackgroundThread() const { return false; }
+
 		virtual Path createPath(Range<int> sampleRange, Range<float> valueRange, Rectangle<float> targetBounds, double startValue) const;
 
 		Array<Identifier> getPropertyList() const;
@@ -229,8 +237,58 @@ struct SimpleRingBuffer: public ComplexDataUIBase,
 
 	int getMaxLengthInSamples() const;
 
+	/** Returns true if the property object reads and transforms this buffer on the BackgroundTransformer thread. */
+	bool transformsOnBackgroundThread() const;
+
+	/** Returns true while the displays are refreshed after a background transformation. */
+	bool isSendingTransformRefresh() const noexcept { return sendingTransformRefresh; }
+
+	/** A shared background thread that reads and transforms the ring buffers with a property object that allows it. */
+	struct BackgroundTransformer : public Thread
+	{
+		BackgroundTransformer();
+		~BackgroundTransformer();
+
+		void addBuffer(SimpleRingBuffer* rb);
+
+		void run() override;
+
+	private:
+
+		CriticalSection queueLock;
+		ReferenceCountedArray<SimpleRingBuffer> pendingBuffers;
+	};
+
 private:
 
+	void readAndTransform();
+
+	/** Refreshes the displays on the message thread after the background transformation. */
+	struct TransformNotifier : public PooledUIUpdater::SimpleTimer,
+							   public AsyncUpdater
+	{
+		TransformNotifier(SimpleRingBuffer& parent_, PooledUIUpdater* updater);
+		~TransformNotifier();
+
+		void timerCallback() override;
+		void handleAsyncUpdate() override;
+
+		/** Call this from the background thread after the transformation. */
+		void trigger();
+
+	private:
+
+		void sendRefresh();
+
+		SimpleRingBuffer& parent;
+		std::atomic<bool> dirty = { false };
+	};
+
+	std::atomic<bool> transformPending = { false };
+	SharedResourcePointer<BackgroundTransformer> backgroundTransformer;
+	ScopedPointer<TransformNotifier> transformNotifier;
+	bool sendingTransformRefresh = false;
+
 	
 
     CriticalSection readBufferLock;
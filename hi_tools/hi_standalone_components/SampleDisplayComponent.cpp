@@ -314,13 +314,88 @@ void MultiChannelAudioBuffer::DataProvider::setRootDirectory(const File& rootDir
 	rootDir = rootDirectory; 
 }
 
-bool MultiChannelAudioBuffer::XYZItem::matches(int n, int v, int r)
+bool MultiChannelAudioBuffer::XYZItem::matches(int n, int v, int r) const
 {
 	return veloRange.contains(v) &&
 		keyRange.contains(n) &&
 		rrGroup == r;
 }
 
+void MultiChannelAudioBuffer::XYZIndex::rebuild(const XYZItem::List& items)
+{
+	clear();
+
+	if (items.isEmpty())
+		return;
+
+	auto minRR = items.getFirst().rrGroup;
+	auto maxRR = minRR;
+
+	for (const auto& item : items)
+	{
+		minRR = jmin(minRR, item.rrGroup);
+		maxRR = jmax(maxRR, item.rrGroup);
+	}
+
+	if (maxRR - minRR >= MaxNumRRGroups || items.size() > std::numeric_limits<int16>::max())
+		return;
+
+	firstRRGroup = minRR;
+	numRRGroups = maxRR - minRR + 1;
+	lookup.insertMultiple(0, (int16)-1, numRRGroups * NumSlotsPerGroup);
+
+	const Range<int> midiRange(0, 128);
+
+	// Iterate backwards so that the first matching item wins (like the linear search)
+	for (int i = items.size() - 1; i >= 0; i--)
+	{
+		const auto& item = items.getReference(i);
+		auto keys = item.keyRange.getIntersectionWith(midiRange);
+		auto velos = item.veloRange.getIntersectionWith(midiRange);
+
+		auto slots = lookup.getRawDataPointer() + (item.rrGroup - firstRRGroup) * NumSlotsPerGroup;
+
+		for (int n = keys.getStart(); n < keys.getEnd(); n++)
+		{
+			for (int v = velos.getStart(); v < velos.getEnd(); v++)
+				slots[n * 128 + v] = (int16)i;
+		}
+	}
+
+	useLinearSearch = false;
+}
+
+void MultiChannelAudioBuffer::XYZIndex::clear()
+{
+	lookup.clearQuick();
+	useLinearSearch = true;
+	firstRRGroup = 0;
+	numRRGroups = 0;
+}
+
+int MultiChannelAudioBuffer::XYZIndex::getIndex(const XYZItem::List& items, int noteNumber, int velocity, int rrGroup) const
+{
+	if (useLinearSearch)
+	{
+		for (int i = 0; i < items.size(); i++)
+		{
+			if (items.getReference(i).matches(noteNumber, velocity, rrGroup))
+				return i;
+		}
+
+		return -1;
+	}
+
+	auto groupIndex = rrGroup - firstRRGroup;
+
+	if (!isPositiveAndBelow(groupIndex, numRRGroups) ||
+		!isPositiveAndBelow(noteNumber, 128) ||
+		!isPositiveAndBelow(velocity, 128))
+		return -1;
+
+	return (int)lookup.getUnchecked(groupIndex * NumSlotsPerGroup + noteNumber * 128 + velocity);
+}
+
 int MultiChannelAudioBuffer::XYZPool::indexOf(const String& ref) const
 {
 	for (int i = 0; i < pool.size(); i++)
@@ -620,6 +695,16 @@ const MultiChannelAudioBuffer::XYZItem::List& MultiChannelAudioBuffer::getXYZIte
 MultiChannelAudioBuffer::XYZItem::List& MultiChannelAudioBuffer::getXYZItems()
 { return xyzItems; }
 
+const MultiChannelAudioBuffer::XYZItem* MultiChannelAudioBuffer::findXYZItem(int noteNumber, int velocity, int rrGroup) const
+{
+	auto idx = xyzIndex.getIndex(xyzItems, noteNumber, velocity, rrGroup);
+
+	if (isPositiveAndBelow(idx, xyzItems.size()))
+		return &xyzItems.getReference(idx);
+
+	return nullptr;
+}
+
 MultiChannelAudioBuffer::SampleReference::Ptr MultiChannelAudioBuffer::getFirstXYZData()
 {
 	if (xyzItems.isEmpty())
@@ -943,6 +1028,233 @@ void AudioDisplayComponent::SampleArea::EdgeLookAndFeel::drawStretchableLayoutRe
 };
 
 
+PeakPyramid::PeakPyramid(int numChannels_, int64 numSamples_):
+	numChannels(numChannels_),
+	numSamples(numSamples_)
+{
+	static_assert(sizeof(Entry) == 3 * sizeof(float), "Entry must be tightly packed");
+	static_assert(sizeof(Header) % sizeof(float) == 0, "Header must keep the entries aligned");
+
+	auto levelSize = (numSamples + BlockSize - 1) / BlockSize;
+
+	while (levelSize > 0)
+	{
+		levelOffsets.add(numEntriesPerChannel);
+		levelSizes.add(levelSize);
+		numEntriesPerChannel += levelSize;
+
+		if (levelSize == 1)
+			break;
+
+		levelSize = (levelSize + 1) / 2;
+	}
+}
+
+PeakPyramid::Ptr PeakPyramid::createFromBuffer(const AudioSampleBuffer& b)
+{
+	Ptr p = new PeakPyramid(b.getNumChannels(), b.getNumSamples());
+
+	if (p->numChannels == 0 || p->numEntriesPerChannel == 0)
+		return nullptr;
+
+	p->ownedData.calloc((size_t)(p->numEntriesPerChannel * p->numChannels));
+	p->data = p->ownedData.get();
+
+	for (int c = 0; c < p->numChannels; c++)
+	{
+		auto src = b.getReadPointer(c);
+		auto channelData = p->ownedData.get() + c * p->numEntriesPerChannel;
+
+		auto firstLevel = channelData + p->levelOffsets[0];
+
+		for (int64 i = 0; i < p->levelSizes[0]; i++)
+		{
+			auto start = (int)(i * BlockSize);
+			auto numToCheck = jmin(BlockSize, b.getNumSamples() - start);
+			auto range = FloatVectorOperations::findMinAndMax(src + start, numToCheck);
+
+			float sumSquares = 0.0f;
+
+			for (int j = 0; j < numToCheck; j++)
+				sumSquares += src[start + j] * src[start + j];
+
+			firstLevel[i] = { range.getStart(), range.getEnd(), std::sqrt(sumSquares / (float)numToCheck) };
+		}
+
+		for (int l = 1; l < p->levelSizes.size(); l++)
+		{
+			auto prev = channelData + p->levelOffsets[l - 1];
+			auto numPrev = p->levelSizes[l - 1];
+			auto dst = channelData + p->levelOffsets[l];
+
+			for (int64 i = 0; i < p->levelSizes[l]; i++)
+			{
+				auto e = prev[i * 2];
+
+				if (i * 2 + 1 < numPrev)
+				{
+					const auto& other = prev[i * 2 + 1];
+					e.minValue = jmin(e.minValue, other.minValue);
+					e.maxValue = jmax(e.maxValue, other.maxValue);
+					e.rms = std::sqrt((e.rms * e.rms + other.rms * other.rms) * 0.5f);
+				}
+
+				dst[i] = e;
+			}
+		}
+	}
+
+	return p;
+}
+
+PeakPyramid::Ptr PeakPyramid::loadFromFile(const File& cacheFile, const File& sourceFile, int64 expectedNumSamples)
+{
+	if (!cacheFile.existsAsFile() || !sourceFile.existsAsFile())
+		return nullptr;
+
+	ScopedPointer<MemoryMappedFile> mf = new MemoryMappedFile(cacheFile, MemoryMappedFile::readOnly);
+
+	if (mf->getData() == nullptr || mf->getSize() < sizeof(Header))
+		return nullptr;
+
+	Header h;
+	memcpy(&h, mf->getData(), sizeof(Header));
+
+	if (h.magic != MagicNumber || h.version != Version)
+		return nullptr;
+
+	if (h.sourceModificationTime != sourceFile.getLastModificationTime().toMilliseconds() ||
+		h.sourceSize != sourceFile.getSize())
+		return nullptr;
+
+	if (expectedNumSamples >= 0 && h.numSamples != expectedNumSamples)
+		return nullptr;
+
+	if (h.numChannels <= 0 || h.numChannels > NUM_MAX_CHANNELS)
+		return nullptr;
+
+	Ptr p = new PeakPyramid((int)h.numChannels, h.numSamples);
+
+	auto expectedSize = sizeof(Header) + sizeof(Entry) * (size_t)(p->numEntriesPerChannel * p->numChannels);
+
+	if (p->numEntriesPerChannel == 0 || mf->getSize() != expectedSize)
+		return nullptr;
+
+	p->data = reinterpret_cast<const Entry*>(static_cast<const uint8*>(mf->getData()) + sizeof(Header));
+	p->mappedFile = mf.release();
+
+	return p;
+}
+
+File PeakPyramid::getSidecarFile(const File& sourceFile, int64 offset)
+{
+	return sourceFile.getSiblingFile(".peaks").getChildFile(sourceFile.getFileName() + "_" + String(offset) + ".peaks");
+}
+
+bool PeakPyramid::writeToFile(const File& cacheFile, const File& sourceFile) const
+{
+	if (data == nullptr || !sourceFile.existsAsFile())
+		return false;
+
+	if (!cacheFile.getParentDirectory().createDirectory())
+		return false;
+
+	TemporaryFile tmp(cacheFile);
+
+	{
+		FileOutputStream fos(tmp.getFile());
+
+		if (!fos.openedOk())
+			return false;
+
+		Header h;
+		h.magic = MagicNumber;
+		h.version = Version;
+		h.numSamples = numSamples;
+		h.numChannels = numChannels;
+		h.sourceModificationTime = sourceFile.getLastModificationTime().toMilliseconds();
+		h.sourceSize = sourceFile.getSize();
+
+		fos.write(&h, sizeof(Header));
+		fos.write(data, sizeof(Entry) * (size_t)(numEntriesPerChannel * numChannels));
+		fos.flush();
+
+		if (fos.getStatus().failed())
+			return false;
+	}
+
+	return tmp.overwriteTargetFileWithTemporary();
+}
+
+const PeakPyramid::Entry* PeakPyramid::getLevel(int channelIndex, int levelIndex) const
+{
+	jassert(isPositiveAndBelow(channelIndex, numChannels));
+	jassert(isPositiveAndBelow(levelIndex, levelSizes.size()));
+
+	return data + channelIndex * numEntriesPerChannel + levelOffsets[levelIndex];
+}
+
+PeakPyramid::Entry PeakPyramid::getLevels(int channelIndex, Range<int64> sampleRange) const
+{
+	sampleRange = sampleRange.getIntersectionWith({ 0, numSamples });
+
+	if (data == nullptr || sampleRange.isEmpty() || !isPositiveAndBelow(channelIndex, numChannels))
+		return {};
+
+	// Use the coarsest level that still has a few entries within the range
+	int levelIndex = 0;
+	int64 blockSize = BlockSize;
+
+	while (levelIndex + 1 < levelSizes.size() && blockSize * 4 <= sampleRange.getLength())
+	{
+		levelIndex++;
+		blockSize *= 2;
+	}
+
+	auto level = getLevel(channelIndex, levelIndex);
+	auto start = sampleRange.getStart() / blockSize;
+	auto end = jmin(levelSizes[levelIndex], (sampleRange.getEnd() + blockSize - 1) / blockSize);
+
+	auto e = level[start];
+	auto sumSquares = e.rms * e.rms;
+
+	for (auto i = start + 1; i < end; i++)
+	{
+		const auto& other = level[i];
+		e.minValue = jmin(e.minValue, other.minValue);
+		e.maxValue = jmax(e.maxValue, other.maxValue);
+		sumSquares += other.rms * other.rms;
+	}
+
+	e.rms = std::sqrt(sumSquares / (float)(end - start));
+	return e;
+}
+
+void HiseAudioThumbnail::LoadingThread::createBuffersFromPyramid(const PeakPyramid& pyramid, int width, var& lb, var& rb)
+{
+	auto numPairs = jmax(1, width) * PyramidValuesPerPixel / 2;
+	auto numSamples = pyramid.getNumSamples();
+
+	for (int c = 0; c < jmin(2, pyramid.getNumChannels()); c++)
+	{
+		VariantBuffer::Ptr b = new VariantBuffer(numPairs * 2);
+		auto d = b->buffer.getWritePointer(0);
+
+		for (int i = 0; i < numPairs; i++)
+		{
+			Range<int64> r(numSamples * i / numPairs, numSamples * (i + 1) / numPairs);
+			auto e = pyramid.getLevels(c, r);
+
+			d[i * 2] = e.minValue;
+			d[i * 2 + 1] = e.maxValue;
+		}
+
+		if (c == 0)
+			lb = var(b.get());
+		else
+			rb = var(b.get());
+	}
+}
 
 void HiseAudioThumbnail::LoadingThread::run()
 {
@@ -951,7 +1263,10 @@ void HiseAudioThumbnail::LoadingThread::run()
 	var rb;
 	ScopedPointer<AudioFormatReader> reader;
 
-    
+	PeakPyramid::Ptr pyramid;
+	File peakSource;
+	int64 peakOffset = 0;
+	bool needsRawData = true;
     
 	bool sv = false;
 
@@ -966,6 +1281,11 @@ void HiseAudioThumbnail::LoadingThread::run()
 
 		bounds = parent->getBounds();
 
+		pyramid = parent->peakPyramid;
+		peakSource = parent->peakSourceFile;
+		peakOffset = parent->peakSourceOffset;
+		needsRawData = parent->requiresRawData();
+
 		if (parent->currentReader != nullptr)
 		{
 			reader.swapWith(parent->currentReader);
@@ -981,6 +1301,34 @@ void HiseAudioThumbnail::LoadingThread::run()
 
 	float* d[2];
 
+	auto sf = UnblurryGraphics::getScaleFactorForComponent(parent, false);
+	float width = (float)bounds.getWidth() * sf;
+
+	if (reader != nullptr && !needsRawData)
+	{
+		// The pyramid can only replace the audio data if the waveform is drawn symmetrically
+		needsRawData = (float)reader->lengthInSamples < width * (float)PyramidValuesPerPixel;
+	}
+
+	if (reader != nullptr && !needsRawData && peakSource != File())
+	{
+		if (pyramid == nullptr)
+			pyramid = PeakPyramid::loadFromFile(PeakPyramid::getSidecarFile(peakSource, peakOffset), peakSource, reader->lengthInSamples);
+
+		if (pyramid != nullptr && parent.get() != nullptr)
+		{
+			ScopedLock sl(parent->lock);
+
+			parent->peakPyramid = pyramid;
+
+			// Keep the reader around in case the raw data is needed later
+			if (parent->currentReader == nullptr)
+				reader.swapWith(parent->currentReader);
+
+			reader = nullptr;
+		}
+	}
+
 	if (reader != nullptr)
 	{
 		VariantBuffer::Ptr l = new VariantBuffer((int)reader->lengthInSamples);
@@ -1011,6 +1359,14 @@ void HiseAudioThumbnail::LoadingThread::run()
 
 		parent->sampleProcessor.sendMessage(sendNotificationSync, lb, rb);
 
+		if (peakSource != File() && pyramid == nullptr)
+		{
+			pyramid = PeakPyramid::createFromBuffer(specBuffer);
+
+			if (pyramid != nullptr)
+				pyramid->writeToFile(PeakPyramid::getSidecarFile(peakSource, peakOffset), peakSource);
+		}
+
 		if (parent.get() != nullptr)
 		{
 			ScopedLock sl(parent->lock);
@@ -1019,6 +1375,7 @@ void HiseAudioThumbnail::LoadingThread::run()
 
 			parent->lBuffer = lb;
 			parent->rBuffer = rb;
+			parent->peakPyramid = pyramid;
 		}
 	}
 	else if(lb.isBuffer())
@@ -1027,6 +1384,10 @@ void HiseAudioThumbnail::LoadingThread::run()
 		d[1] = rb.isBuffer() ? rb.getBuffer()->buffer.getWritePointer(0) : nullptr;
 		specBuffer = AudioSampleBuffer(d, rb.isBuffer() ? 2 : 1, lb.getBuffer()->size);
 	}
+	else if (pyramid != nullptr)
+	{
+		createBuffersFromPyramid(*pyramid, roundToInt(width), lb, rb);
+	}
 
 	Image newSpec;
 
@@ -1054,9 +1415,6 @@ void HiseAudioThumbnail::LoadingThread::run()
 
 	RectangleListType lRects, rRects;
 
-	auto sf = UnblurryGraphics::getScaleFactorForComponent(parent, false);
-	float width = (float)bounds.getWidth() * sf;
-
 	VariantBuffer::Ptr r = rb.getBuffer();
 	VariantBuffer::Ptr l = lb.getBuffer();
 
@@ -1457,7 +1815,15 @@ void HiseAudioThumbnail::setRebuildOnResize(bool shouldRebuild)
 
 bool HiseAudioThumbnail::isEmpty() const noexcept
 {
-	return isClear || !lBuffer.isBuffer();
+	return isClear || (!lBuffer.isBuffer() && peakPyramid == nullptr);
+}
+
+bool HiseAudioThumbnail::requiresRawData() const
+{
+	return spectrumAlpha != 0.0f ||
+		   sampleProcessor.hasListeners() ||
+		   currentOptions.displayMode != DisplayMode::SymmetricArea ||
+		   currentOptions.forceSymmetry == 1;
 }
 
 HiseAudioThumbnail::AudioDataProcessor& HiseAudioThumbnail::getAudioDataProcessor()
@@ -1690,6 +2056,8 @@ void HiseAudioThumbnail::setBuffer(var bufferL, var bufferR /*= var()*/, bool sy
 	ScopedLock sl(lock);
 
 	currentReader = nullptr;
+	peakPyramid = nullptr;
+	peakSourceFile = File();
 
 	const bool shouldBeNotEmpty = bufferL.isBuffer() && bufferL.getBuffer()->size != 0;
 	const bool isNotEmpty = lBuffer.isBuffer() && lBuffer.getBuffer()->size != 0;
@@ -2012,8 +2380,15 @@ void HiseAudioThumbnail::setDisplayGain(float gainToApply, NotificationType noti
 	}
 }
 
-void HiseAudioThumbnail::setReader(AudioFormatReader* r, int64 actualNumSamples)
+void HiseAudioThumbnail::setReader(AudioFormatReader* r, int64 actualNumSamples, const File& peakSourceFile_, int64 peakSourceOffset_)
 {
+	{
+		ScopedLock sl(lock);
+		peakSourceFile = peakSourceFile_;
+		peakSourceOffset = peakSourceOffset_;
+		peakPyramid = nullptr;
+	}
+
 	currentReader = r;
 
 	if (actualNumSamples == -1)
@@ -2046,6 +2421,8 @@ void HiseAudioThumbnail::clear()
 	spectrum = {};
 	isClear = true;
 	currentReader = nullptr;
+	peakPyramid = nullptr;
+	peakSourceFile = File();
 
 	repaint();
 }
@@ -2701,6 +3078,7 @@ bool MultiChannelAudioBuffer::fromBase64String(const String& b64)
 			{
 				SimpleReadWriteLock::ScopedWriteLock sl(getDataLock());
 				xyzItems.clear();
+				xyzIndex.clear();
 				getUpdater().sendContentRedirectMessage();
 				return true;
 			}
@@ -2715,11 +3093,14 @@ bool MultiChannelAudioBuffer::fromBase64String(const String& b64)
 				{
 					SimpleReadWriteLock::ScopedWriteLock sl(getDataLock());
 					xyzItems.clear();
+					xyzIndex.clear();
 
 					try
 					{
 						auto ok = xyzProvider->parse(b64, xyzItems);
 
+						xyzIndex.rebuild(xyzItems);
+
 						getUpdater().sendContentRedirectMessage();
 
 						return ok;
@@ -44,6 +44,84 @@ class AudioDisplayComponent;
 
 #define EDGE_WIDTH 8
 
+/** A multi-resolution min / max / RMS overview of audio data that can be stored in a sidecar file.
+
+	The first level contains one entry per BlockSize samples and every other level halves the resolution
+	of the level before, so any sample range can be summarised by looking at a handful of entries.
+	This makes drawing a waveform at any zoom level O(pixels) instead of O(samples).
+
+	The sidecar file is memory-mapped when loaded and will be rejected if the source file has changed
+	since the pyramid was written.
+*/
+class PeakPyramid : public ReferenceCountedObject
+{
+public:
+
+	using Ptr = ReferenceCountedObjectPtr<PeakPyramid>;
+
+	static constexpr int BlockSize = 64;
+
+	struct Entry
+	{
+		float minValue = 0.0f;
+		float maxValue = 0.0f;
+		float rms = 0.0f;
+	};
+
+	/** Creates a pyramid from the channels of the given buffer. */
+	static Ptr createFromBuffer(const AudioSampleBuffer& b);
+
+	/** Memory-maps the given cache file and returns a pyramid if it is still valid for the source file. */
+	static Ptr loadFromFile(const File& cacheFile, const File& sourceFile, int64 expectedNumSamples);
+
+	/** Returns the sidecar file for the audio data at the given offset of the source file.
+	
+		The cache files are stored in a hidden directory next to the source file so that multiple samples
+		of a monolith can be cached independently.
+	*/
+	static File getSidecarFile(const File& sourceFile, int64 offset);
+
+	/** Writes the pyramid to the cache file. */
+	bool writeToFile(const File& cacheFile, const File& sourceFile) const;
+
+	/** Returns the combined levels of the given channel within the sample range. */
+	Entry getLevels(int channelIndex, Range<int64> sampleRange) const;
+
+	int getNumChannels() const noexcept { return numChannels; }
+	int64 getNumSamples() const noexcept { return numSamples; }
+
+private:
+
+	struct Header
+	{
+		uint32 magic;
+		uint32 version;
+		int64 numSamples;
+		int64 numChannels;
+		int64 sourceModificationTime;
+		int64 sourceSize;
+	};
+
+	static constexpr uint32 MagicNumber = 0x4b505048; // 'HPPK'
+	static constexpr uint32 Version = 1;
+
+	PeakPyramid(int numChannels, int64 numSamples);
+
+	const Entry* getLevel(int channelIndex, int levelIndex) const;
+
+	int numChannels = 0;
+	int64 numSamples = 0;
+	int64 numEntriesPerChannel = 0;
+	Array<int64> levelOffsets;
+	Array<int64> levelSizes;
+
+	HeapBlock<Entry> ownedData;
+	ScopedPointer<MemoryMappedFile> mappedFile;
+	const Entry* data = nullptr;
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PeakPyramid);
+};
+
 class HiseAudioThumbnail: public ComponentWithMiddleMouseDrag,
 						  public AsyncUpdater,
                           public Spectrum2D::Holder
@@ -131,7 +209,13 @@ public:
 
 	Spectrum2D::Parameters::Ptr getParameters() const override;;
 
-	void setReader(AudioFormatReader* r, int64 actualNumSamples=-1);
+	/** Sets a reader that will be used to create the waveform.
+	
+		If you pass in the file (and offset for monolith samples) that the reader is reading from,
+		the thumbnail will store a PeakPyramid in a sidecar file and skip decoding the audio data
+		the next time if it doesn't need the raw samples.
+	*/
+	void setReader(AudioFormatReader* r, int64 actualNumSamples=-1, const File& peakSourceFile={}, int64 peakSourceOffset=0);
 
 	void clear();
 
@@ -195,6 +279,9 @@ private:
 
 	void rebuildPaths(bool synchronously = false);
 
+	/** Returns true if the current options need the decoded audio data (and can't be drawn from a PeakPyramid). */
+	bool requiresRawData() const;
+
 	class LoadingThread : public Thread
 	{
 	public:
@@ -207,6 +294,12 @@ private:
 
 		void calculatePath(Path &p, float width, const float* l_, int numSamples, RectangleListType& rects, bool isLeft);
 
+		/** Creates min / max pairs from the pyramid with enough resolution to be drawn as symmetric waveform. */
+		static void createBuffersFromPyramid(const PeakPyramid& pyramid, int width, var& lb, var& rb);
+
+		/** The amount of values per pixel that the pyramid buffers contain (it must exceed the stride for symmetric waveforms). */
+		static constexpr int PyramidValuesPerPixel = 64;
+
 	private:
 
         AudioSampleBuffer tempBuffer;
@@ -227,6 +320,10 @@ private:
 
 	ScopedPointer<AudioFormatReader> currentReader;
 
+	File peakSourceFile;
+	int64 peakSourceOffset = 0;
+	PeakPyramid::Ptr peakPyramid;
+
 	ScopedPointer<ScrollBar> scrollBar;
 
 	AudioSampleBuffer ab;
@@ -554,7 +651,7 @@ struct MultiChannelAudioBuffer : public ComplexDataUIBase
 	{
 		using List = Array<XYZItem>;
 
-		bool matches(int n, int v, int r);
+		bool matches(int n, int v, int r) const;
 
 		Range<int> veloRange;
 		Range<int> keyRange;
@@ -563,6 +660,29 @@ struct MultiChannelAudioBuffer : public ComplexDataUIBase
 		SampleReference::Ptr data;
 	};
 
+	/** A lookup table that returns the first matching XYZ item for a note / velocity / RR group in constant time. */
+	struct XYZIndex
+	{
+		/** The amount of RR groups that can be indexed. Lists with more groups will use a linear search. */
+		static constexpr int MaxNumRRGroups = 32;
+
+		void rebuild(const XYZItem::List& items);
+
+		void clear();
+
+		/** Returns the index of the first item that matches or -1. */
+		int getIndex(const XYZItem::List& items, int noteNumber, int velocity, int rrGroup) const;
+
+	private:
+
+		static constexpr int NumSlotsPerGroup = 128 * 128;
+
+		bool useLinearSearch = true;
+		int firstRRGroup = 0;
+		int numRRGroups = 0;
+		Array<int16> lookup;
+	};
+
 	struct XYZPool : public DataProvider
 	{
 		int indexOf(const String& ref) const;
@@ -711,6 +831,13 @@ struct MultiChannelAudioBuffer : public ComplexDataUIBase
 	const XYZItem::List& getXYZItems() const;
 	XYZItem::List& getXYZItems();
 
+	/** Returns the first XYZ item that matches the note, velocity and RR group. 
+	
+		This uses a lookup table that is rebuilt whenever the items are loaded so it's safe to call on voice start
+		(while holding the data read lock).
+	*/
+	const XYZItem* findXYZItem(int noteNumber, int velocity, int rrGroup) const;
+
 	SampleReference::Ptr getFirstXYZData();
 
 	void setDisabledXYZProviders(const Array<Identifier>& ids);
@@ -748,6 +875,7 @@ private:
 	DataProvider::Ptr provider;
 
 	XYZItem::List xyzItems;
+	XYZIndex xyzIndex;
 	ReferenceCountedObjectPtr<XYZProviderBase> xyzProvider;
 
 	JUCE_DECLARE_WEAK_REFERENCEABLE(MultiChannelAudioBuffer);
@@ -202,6 +202,16 @@ will break compatibility with older projects / presets because the tempo indexes
 #define HISE_INCLUDE_PROFILING_TOOLKIT 0
 #endif
 
+/** Config: HISE_INCLUDE_LIGHTWEIGHT_TRACER
+
+If this is enabled (and the profiling toolkit is disabled), the ProfiledProcessor scopes of the audio rendering
+will write their timings into lock-free ring buffers that can be dumped with Settings.dumpLightweightTrace().
+The overhead is two timestamps per scope, so you can use this in exported plugins.
+*/
+#ifndef HISE_INCLUDE_LIGHTWEIGHT_TRACER
+#define HISE_INCLUDE_LIGHTWEIGHT_TRACER 0
+#endif
+
 #ifndef HISE_USE_ONLINE_DOC_UPDATER
 #define HISE_USE_ONLINE_DOC_UPDATER 0
 #endif
@@ -241,6 +251,7 @@ will break compatibility with older projects / presets because the tempo indexes
 #include "hi_tools/ValueTreeHelpers.h"
 
 #include "hi_tools/runtime_target.h"
+#include "hi_tools/LightweightTracer.h"
 
 #if USE_IPP
 #if _IPP_SEQUENTIAL_STATIC || _IPP_SEQUENTIAL_DYNAMIC || _IPP_PARALLEL_STATIC || _IPP_PARALLEL_DYNAMIC
@@ -33,4 +33,80 @@
 
 
 
+namespace hise { using namespace juce;
+
+SnapshotPublisherBase::SnapshotPublisherBase()
+{
+	numReaders[0].store(0);
+	numReaders[1].store(0);
+}
+
+SnapshotPublisherBase::~SnapshotPublisherBase()
+{
+	// You need to call stopCollecting() in the destructor of your subclass
+	jassert(!collecting);
+	stopCollecting();
+}
+
+void SnapshotPublisherBase::startCollecting()
+{
+	if (!collecting)
+	{
+		reclaimer->addPublisher(this);
+		collecting = true;
+	}
+}
+
+void SnapshotPublisherBase::stopCollecting()
+{
+	if (collecting)
+	{
+		reclaimer->removePublisher(this);
+		collecting = false;
+	}
+}
+
+SnapshotPublisherBase::Reclaimer::Reclaimer() :
+	Thread("Snapshot Reclaimer")
+{}
+
+SnapshotPublisherBase::Reclaimer::~Reclaimer()
+{
+	stopThread(1000);
+}
+
+void SnapshotPublisherBase::Reclaimer::run()
+{
+	while (!threadShouldExit())
+	{
+		{
+			ScopedLock sl(publisherLock);
+
+			for (auto p : publishers)
+				p->collectGarbage();
+		}
+
+		wait(100);
+	}
+}
+
+void SnapshotPublisherBase::Reclaimer::addPublisher(SnapshotPublisherBase* p)
+{
+	{
+		ScopedLock sl(publisherLock);
+		publishers.addIfNotAlreadyThere(p);
+	}
+
+	if (!isThreadRunning())
+		startThread();
+}
+
+void SnapshotPublisherBase::Reclaimer::removePublisher(SnapshotPublisherBase* p)
+{
+	ScopedLock sl(publisherLock);
+	publishers.removeAllInstancesOf(p);
+}
+
+} // namespace hise
+
 /** ============================================================================================================================== UNIT TEST */
@@ -1446,6 +1446,201 @@ private:
 	moodycamel::ReaderWriterQueue<ElementType> queue;
 };
 
+
+/** The base class for a SnapshotPublisher that manages the reader epochs and the background deletion. */
+class SnapshotPublisherBase
+{
+public:
+
+	virtual ~SnapshotPublisherBase();
+
+	/** Deletes the retired snapshots that can't be accessed by a reader anymore. 
+	
+		This is called periodically by a shared background thread. 
+	*/
+	virtual void collectGarbage() = 0;
+
+	/** A background thread that calls collectGarbage() on all registered publishers. */
+	struct Reclaimer : public Thread
+	{
+		Reclaimer();
+		~Reclaimer();
+
+		void run() override;
+
+		void addPublisher(SnapshotPublisherBase* p);
+		void removePublisher(SnapshotPublisherBase* p);
+
+	private:
+
+		CriticalSection publisherLock;
+		Array<SnapshotPublisherBase*> publishers;
+	};
+
+protected:
+
+	SnapshotPublisherBase();
+
+	/** Call startCollecting() before the first publication and stopCollecting() in the destructor of your subclass so that the reclaimer thread never accesses a half constructed object. */
+	void startCollecting();
+	void stopCollecting();
+
+	/** Registers a reader in the current epoch and returns the epoch index that needs to be passed into exitReader(). */
+	int enterReader() const noexcept
+	{
+		for (;;)
+		{
+			auto e = epoch.load();
+			auto idx = (int)(e & 1);
+
+			numReaders[idx].fetch_add(1);
+
+			// If the epoch was advanced in the meantime, the reader might have been missed
+			if (epoch.load() == e)
+				return idx;
+
+			numReaders[idx].fetch_sub(1);
+		}
+	}
+
+	void exitReader(int epochIndex) const noexcept
+	{
+		numReaders[epochIndex].fetch_sub(1);
+	}
+
+	/** Advances the epoch and returns the index of the previous epoch. */
+	int advanceEpoch() noexcept
+	{
+		return (int)(epoch.fetch_add(1) & 1);
+	}
+
+	bool isEpochDrained(int epochIndex) const noexcept
+	{
+		return numReaders[epochIndex].load() == 0;
+	}
+
+private:
+
+	std::atomic<uint32> epoch = { 0 };
+	mutable std::atomic<int> numReaders[2];
+
+	SharedResourcePointer<Reclaimer> reclaimer;
+	bool collecting = false;
+
+	JUCE_DECLARE_NON_COPYABLE(SnapshotPublisherBase);
+};
+
+/** A lock-free publication slot for immutable snapshots (read-copy-update).
+
+	A writer creates a new snapshot and publishes it with a single pointer swap. A reader 
+	pins the current snapshot with a ScopedReader (eg. for the duration of a processing block)
+	without ever waiting for a writer. The replaced snapshots are deleted on a background 
+	thread as soon as no reader can access them anymore.
+
+	Only two reader epochs are alive at any time: the epoch is advanced when retired snapshots
+	are collected and they are deleted once all readers of the previous epoch have exited.
+*/
+template <typename T> class SnapshotPublisher : public SnapshotPublisherBase
+{
+public:
+
+	/** Pins the current snapshot for the lifetime of this object. If the publisher is nullptr, the snapshot will be empty. */
+	struct ScopedReader
+	{
+		ScopedReader(const SnapshotPublisher* p) noexcept :
+			parent(p),
+			epochIndex(p != nullptr ? p->enterReader() : -1),
+			snapshot(p != nullptr ? p->current.load() : nullptr)
+		{}
+
+		ScopedReader(const SnapshotPublisher& p) noexcept :
+			ScopedReader(&p)
+		{}
+
+		~ScopedReader()
+		{
+			if (parent != nullptr)
+				parent->exitReader(epochIndex);
+		}
+
+		const T* get() const noexcept { return snapshot; }
+		const T* operator->() const noexcept { return snapshot; }
+		explicit operator bool() const noexcept { return snapshot != nullptr; }
+
+	private:
+
+		const SnapshotPublisher* parent;
+		const int epochIndex;
+		const T* snapshot;
+
+		JUCE_DECLARE_NON_COPYABLE(ScopedReader);
+	};
+
+	SnapshotPublisher() = default;
+
+	~SnapshotPublisher() override
+	{
+		stopCollecting();
+		delete current.exchange(nullptr);
+	}
+
+	/** Publishes a new snapshot and takes ownership. The old snapshot will be deleted on the background thread. */
+	void publish(T* newSnapshot)
+	{
+		// A publisher that is never used doesn't need to be visited by the reclaimer thread
+		startCollecting();
+
+		ScopedLock sl(writerLock);
+
+		if (auto old = current.exchange(newSnapshot))
+			retired.add(old);
+	}
+
+	void collectGarbage() override
+	{
+		ScopedLock sl(writerLock);
+
+		if (waitingEpochIndex != -1)
+		{
+			if (!isEpochDrained(waitingEpochIndex))
+				return;
+
+			waiting.clear();
+			waitingEpochIndex = -1;
+		}
+
+		if (retired.isEmpty())
+			return;
+
+		waiting.swapWith(retired);
+		waitingEpochIndex = advanceEpoch();
+
+		if (isEpochDrained(waitingEpochIndex))
+		{
+			waiting.clear();
+			waitingEpochIndex = -1;
+		}
+	}
+
+	/** Returns the number of replaced snapshots that haven't been deleted yet. */
+	int getNumPendingSnapshots() const
+	{
+		ScopedLock sl(writerLock);
+		return retired.size() + waiting.size();
+	}
+
+private:
+
+	CriticalSection writerLock;
+	std::atomic<T*> current = { nullptr };
+
+	OwnedArray<T> retired;
+	OwnedArray<T> waiting;
+	int waitingEpochIndex = -1;
+
+	JUCE_DECLARE_NON_COPYABLE(SnapshotPublisher);
+};
+
 } // namespace hise
 
 #endif  // CUSTOMDATACONTAINERS_H_INCLUDED
@@ -0,0 +1,281 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Commercial licenses for using HISE in an closed source project are
+*   available on request. Please visit the project's website to get more
+*   information about commercial licensing:
+*
+*   http://www.hise.audio/
+*
+*   HISE is based on the JUCE library,
+*   which must be separately licensed for closed source applications:
+*
+*   http://www.juce.com
+*
+*   ===========================================================================
+*/
+
+namespace hise { using namespace juce;
+
+static_assert(isPowerOfTwo(LightweightTracer::NumRecordsPerThread), "must be power of two");
+
+LightweightTracer::ScopedTrace::ScopedTrace(const void* owner, int scopeIndex) noexcept
+{
+	r.owner = owner;
+	r.scopeIndex = scopeIndex;
+	r.startTicks = Time::getHighResolutionTicks();
+}
+
+LightweightTracer::ScopedTrace::~ScopedTrace() noexcept
+{
+	r.endTicks = Time::getHighResolutionTicks();
+	LightweightTracer::getInstance().addRecord(r);
+}
+
+LightweightTracer& LightweightTracer::getInstance()
+{
+	static LightweightTracer instance;
+	return instance;
+}
+
+LightweightTracer::LightweightTracer()
+{
+	for (auto& b : buffers)
+		b.records.calloc(NumRecordsPerThread);
+}
+
+void LightweightTracer::registerNameProvider(const void* owner, NameProvider* p)
+{
+	ScopedLock sl(providerLock);
+	providers[owner] = p;
+}
+
+void LightweightTracer::unregisterNameProvider(const void* owner)
+{
+	ScopedLock sl(providerLock);
+	providers.erase(owner);
+}
+
+LightweightTracer::ThreadBuffer* LightweightTracer::getBufferForCurrentThread() noexcept
+{
+	// Releases the buffer when the thread exits so that it can be picked up by another thread
+	struct BufferHolder
+	{
+		~BufferHolder()
+		{
+			if (buffer != nullptr)
+				buffer->used.store(false, std::memory_order_release);
+		}
+
+		ThreadBuffer* buffer = nullptr;
+		bool noBufferAvailable = false;
+	};
+
+	static thread_local BufferHolder holder;
+
+	if (holder.buffer != nullptr)
+		return holder.buffer;
+
+	if (holder.noBufferAvailable)
+		return nullptr;
+
+	for (auto& b : buffers)
+	{
+		auto expected = false;
+
+		if (b.used.compare_exchange_strong(expected, true, std::memory_order_acquire))
+		{
+			b.threadId = Thread::getCurrentThreadId();
+
+			String name;
+
+			if (auto t = Thread::getCurrentThread())
+				name = t->getThreadName();
+			else if (MessageManager::getInstanceWithoutCreating() != nullptr && MessageManager::getInstance()->isThisTheMessageThread())
+				name = "Message Thread";
+
+			name.copyToUTF8(b.threadName, sizeof(b.threadName));
+
+			holder.buffer = &b;
+			return holder.buffer;
+		}
+	}
+
+	holder.noBufferAvailable = true;
+	return nullptr;
+}
+
+void LightweightTracer::addRecord(const Record& r) noexcept
+{
+	if (auto b = getBufferForCurrentThread())
+	{
+		auto index = b->numWritten.load(std::memory_order_relaxed);
+		b->records[(int)(index & (NumRecordsPerThread - 1))] = r;
+		b->numWritten.store(index + 1, std::memory_order_release);
+	}
+}
+
+void LightweightTracer::clear() noexcept
+{
+	clearTicks.store(Time::getHighResolutionTicks());
+}
+
+void LightweightTracer::copyRecords(const ThreadBuffer& b, Array<Record>& list) const
+{
+	auto end = b.numWritten.load(std::memory_order_acquire);
+	auto start = end > (uint64)NumRecordsPerThread ? end - (uint64)NumRecordsPerThread : 0;
+	auto minTicks = clearTicks.load();
+
+	Array<Record> copy;
+	copy.ensureStorageAllocated((int)(end - start));
+
+	for (auto i = start; i < end; i++)
+		copy.add(b.records[(int)(i & (NumRecordsPerThread - 1))]);
+
+	// Skip the records that the writer thread has overwritten while we were copying
+	auto endAfterCopy = b.numWritten.load(std::memory_order_acquire);
+	auto firstValid = endAfterCopy > (uint64)NumRecordsPerThread ? endAfterCopy - (uint64)NumRecordsPerThread : 0;
+	auto numToSkip = firstValid > start ? (int)(firstValid - start) : 0;
+
+	for (int i = numToSkip; i < copy.size(); i++)
+	{
+		const auto& r = copy.getReference(i);
+
+		if (r.startTicks >= minTicks && r.endTicks >= r.startTicks)
+			list.add(r);
+	}
+}
+
+int LightweightTracer::getNumRecords() const
+{
+	int numRecords = 0;
+
+	for (const auto& b : buffers)
+	{
+		Array<Record> list;
+		copyRecords(b, list);
+		numRecords += list.size();
+	}
+
+	return numRecords;
+}
+
+var LightweightTracer::createChromeTrace() const
+{
+	Array<var> events;
+
+	std::map<std::pair<const void*, int>, String> nameCache;
+
+	auto getName = [&](const Record& r)
+	{
+		auto key = std::make_pair(r.owner, r.scopeIndex);
+		auto it = nameCache.find(key);
+
+		if (it != nameCache.end())
+			return it->second;
+
+		String name;
+
+		{
+			ScopedLock sl(providerLock);
+
+			auto p = providers.find(r.owner);
+
+			if (p != providers.end())
+				name = p->second->getTraceScopeName(r.scopeIndex);
+		}
+
+		if (name.isEmpty())
+			name = "Unknown scope " + String(r.scopeIndex);
+
+		nameCache[key] = name;
+		return name;
+	};
+
+	int64 firstTick = std::numeric_limits<int64>::max();
+	OwnedArray<Array<Record>> recordsPerThread;
+
+	for (const auto& b : buffers)
+	{
+		auto list = recordsPerThread.add(new Array<Record>());
+
+		copyRecords(b, *list);
+
+		for (const auto& r : *list)
+			firstTick = jmin(firstTick, r.startTicks);
+	}
+
+	auto toMicroSeconds = [firstTick](int64 ticks)
+	{
+		return Time::highResolutionTicksToSeconds(ticks - firstTick) * 1000000.0;
+	};
+
+	for (int i = 0; i < MaxNumThreads; i++)
+	{
+		const auto& list = *recordsPerThread[i];
+
+		if (list.isEmpty())
+			continue;
+
+		auto threadName = String(CharPointer_UTF8(buffers[i].threadName));
+
+		if (threadName.isEmpty())
+			threadName = "Thread " + String::toHexString((pointer_sized_int)buffers[i].threadId);
+
+		DynamicObject::Ptr meta = new DynamicObject();
+		meta->setProperty("name", "thread_name");
+		meta->setProperty("ph", "M");
+		meta->setProperty("pid", 1);
+		meta->setProperty("tid", i);
+
+		DynamicObject::Ptr args = new DynamicObject();
+		args->setProperty("name", threadName);
+		meta->setProperty("args", var(args.get()));
+		events.add(var(meta.get()));
+
+		for (const auto& r : list)
+		{
+			DynamicObject::Ptr e = new DynamicObject();
+			e->setProperty("name", getName(r));
+			e->setProperty("ph", "X");
+			e->setProperty("pid", 1);
+			e->setProperty("tid", i);
+			e->setProperty("ts", toMicroSeconds(r.startTicks));
+			e->setProperty("dur", Time::highResolutionTicksToSeconds(r.endTicks - r.startTicks) * 1000000.0);
+			events.add(var(e.get()));
+		}
+	}
+
+	DynamicObject::Ptr obj = new DynamicObject();
+	obj->setProperty("traceEvents", var(events));
+	obj->setProperty("displayTimeUnit", "ms");
+
+	return var(obj.get());
+}
+
+Result LightweightTracer::writeChromeTrace(const File& targetFile) const
+{
+	auto trace = createChromeTrace();
+
+	if (!targetFile.replaceWithText(JSON::toString(trace, true)))
+		return Result::fail("Can't write to " + targetFile.getFullPathName());
+
+	return Result::ok();
+}
+
+} // namespace hise
@@ -0,0 +1,136 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Commercial licenses for using HISE in an closed source project are
+*   available on request. Please visit the project's website to get more
+*   information about commercial licensing:
+*
+*   http://www.hise.audio/
+*
+*   HISE is based on the JUCE library,
+*   which must be separately licensed for closed source applications:
+*
+*   http://www.juce.com
+*
+*   ===========================================================================
+*/
+
+#pragma once
+
+namespace hise { using namespace juce;
+
+/** A low overhead tracer that records scope timings into lock-free per-thread ring buffers.
+
+	This is the production counterpart of the DebugSession profiler: if you compile a project with
+	HISE_INCLUDE_LIGHTWEIGHT_TRACER=1 (and without the profiling toolkit), the ProfiledProcessor scopes
+	of the audio rendering will write a fixed size record into the ring buffer of the current thread.
+
+	Writing a record doesn't lock or allocate (the buffers are preallocated when the tracer is created),
+	so it can be left on in the exported plugin. Whenever you need the data (eg. to diagnose a dropout
+	on a customer system), call writeChromeTrace() which will create a JSON file that can be loaded into
+	chrome://tracing or https://ui.perfetto.dev.
+
+	Each thread will only keep the last NumRecordsPerThread records. If a thread exits, its buffer
+	will be handed over to the next thread that writes a record.
+*/
+class LightweightTracer
+{
+public:
+
+	static constexpr int NumRecordsPerThread = 8192;
+	static constexpr int MaxNumThreads = 16;
+
+	/** A single entry in the ring buffer. */
+	struct Record
+	{
+		const void* owner = nullptr;
+		int scopeIndex = 0;
+		int64 startTicks = 0;
+		int64 endTicks = 0;
+	};
+
+	/** Subclass any object that creates trace scopes from this and register it with registerNameProvider()
+	    so that the scopes get a readable name in the trace file. */
+	struct NameProvider
+	{
+		virtual ~NameProvider() {};
+
+		/** Return the name of the scope with the given index. This is only called when the trace file is created. */
+		virtual String getTraceScopeName(int scopeIndex) const = 0;
+	};
+
+	/** Measures the lifetime of this object and adds it as record to the tracer. */
+	struct ScopedTrace
+	{
+		ScopedTrace(const void* owner, int scopeIndex) noexcept;
+		~ScopedTrace() noexcept;
+
+	private:
+
+		Record r;
+	};
+
+	/** Returns the global tracer instance (and creates it with the preallocated buffers on the first call). */
+	static LightweightTracer& getInstance();
+
+	void registerNameProvider(const void* owner, NameProvider* p);
+	void unregisterNameProvider(const void* owner);
+
+	/** Adds a record to the buffer of the current thread. This is lock-free and can be called from the audio thread. */
+	void addRecord(const Record& r) noexcept;
+
+	/** Discards all records that were added before this call. */
+	void clear() noexcept;
+
+	/** Creates a JSON object with the Chrome trace event format from all records. */
+	var createChromeTrace() const;
+
+	/** Writes the records to the given file as Chrome trace event JSON. */
+	Result writeChromeTrace(const File& targetFile) const;
+
+	/** Returns the number of records that can be found in all ring buffers. */
+	int getNumRecords() const;
+
+private:
+
+	LightweightTracer();
+
+	struct ThreadBuffer
+	{
+		std::atomic<bool> used = { false };
+		std::atomic<uint64> numWritten = { 0 };
+		Thread::ThreadID threadId = nullptr;
+		char threadName[64] = { 0 };
+		HeapBlock<Record> records;
+	};
+
+	ThreadBuffer* getBufferForCurrentThread() noexcept;
+
+	/** Copies the valid records of the given buffer (skipping the ones that were overwritten while reading). */
+	void copyRecords(const ThreadBuffer& b, Array<Record>& list) const;
+
+	ThreadBuffer buffers[MaxNumThreads];
+	std::atomic<int64> clearTicks = { 0 };
+
+	CriticalSection providerLock;
+	std::map<const void*, NameProvider*> providers;
+
+	JUCE_DECLARE_NON_COPYABLE(LightweightTracer);
+};
+
+} // namespace hise
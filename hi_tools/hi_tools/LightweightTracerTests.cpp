@@ -0,0 +1,198 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   ===========================================================================
+*/
+
+namespace hise {
+using namespace juce;
+
+class LightweightTracerTests : public UnitTest
+{
+public:
+
+	LightweightTracerTests() : UnitTest("LightweightTracer Tests", "Misc Tools") {}
+
+	void runTest() override
+	{
+		testSingleThread();
+		testRingBufferWrap();
+		testMultipleThreads();
+		testChromeTraceFormat();
+	}
+
+private:
+
+	struct TestProvider : public LightweightTracer::NameProvider
+	{
+		TestProvider()
+		{
+			LightweightTracer::getInstance().registerNameProvider(this, this);
+		}
+
+		~TestProvider()
+		{
+			LightweightTracer::getInstance().unregisterNameProvider(this);
+		}
+
+		String getTraceScopeName(int scopeIndex) const override
+		{
+			return "TestScope" + String(scopeIndex);
+		}
+	};
+
+	void testSingleThread()
+	{
+		beginTest("Single thread records");
+
+		auto& t = LightweightTracer::getInstance();
+		t.clear();
+		Thread::sleep(1);
+
+		TestProvider p;
+
+		for (int i = 0; i < 10; i++)
+			LightweightTracer::ScopedTrace s(&p, i);
+
+		expectEquals(t.getNumRecords(), 10, "record count mismatch");
+
+		t.clear();
+		Thread::sleep(1);
+		expectEquals(t.getNumRecords(), 0, "clear doesn't discard records");
+	}
+
+	void testRingBufferWrap()
+	{
+		beginTest("Ring buffer only keeps the last records");
+
+		auto& t = LightweightTracer::getInstance();
+		t.clear();
+		Thread::sleep(1);
+
+		TestProvider p;
+
+		for (int i = 0; i < LightweightTracer::NumRecordsPerThread * 2 + 5; i++)
+			LightweightTracer::ScopedTrace s(&p, 0);
+
+		expectEquals(t.getNumRecords(), LightweightTracer::NumRecordsPerThread, "ring buffer overflow");
+		t.clear();
+	}
+
+	void testMultipleThreads()
+	{
+		beginTest("Concurrent writers");
+
+		auto& t = LightweightTracer::getInstance();
+		t.clear();
+		Thread::sleep(1);
+
+		TestProvider p;
+
+		static constexpr int NumThreads = 4;
+		static constexpr int NumRecordsPerWriter = 1000;
+
+		OwnedArray<Thread> threads;
+
+		for (int i = 0; i < NumThreads; i++)
+		{
+			struct Writer : public Thread
+			{
+				Writer(TestProvider& p_, int index_) :
+					Thread("Tracer Test " + String(index_)),
+					p(p_),
+					index(index_)
+				{}
+
+				void run() override
+				{
+					for (int i = 0; i < NumRecordsPerWriter; i++)
+						LightweightTracer::ScopedTrace s(&p, index);
+				}
+
+				TestProvider& p;
+				const int index;
+			};
+
+			threads.add(new Writer(p, i))->startThread();
+		}
+
+		// read concurrently to make sure that the reader doesn't block or crash
+		while (threads.getFirst()->isThreadRunning())
+			t.getNumRecords();
+
+		for (auto th : threads)
+			th->stopThread(1000);
+
+		expectEquals(t.getNumRecords(), NumThreads * NumRecordsPerWriter, "lost records");
+	}
+
+	void testChromeTraceFormat()
+	{
+		beginTest("Chrome trace format");
+
+		auto& t = LightweightTracer::getInstance();
+		t.clear();
+		Thread::sleep(1);
+
+		TestProvider p;
+
+		{
+			LightweightTracer::ScopedTrace s(&p, 42);
+		}
+
+		// there's no provider for this owner, so this must fall back to the default name
+		{
+			int unknownOwner = 0;
+			LightweightTracer::ScopedTrace s(&unknownOwner, 3);
+		}
+
+		auto trace = t.createChromeTrace();
+		auto events = trace["traceEvents"];
+
+		expect(events.isArray(), "no event list");
+
+		StringArray names;
+		int numMetadata = 0;
+
+		for (const auto& e : *events.getArray())
+		{
+			if (e["ph"].toString() == "M")
+				numMetadata++;
+			else
+			{
+				expectEquals(e["ph"].toString(), String("X"), "wrong event type");
+				expect((double)e["dur"] >= 0.0, "negative duration");
+				names.add(e["name"].toString());
+			}
+		}
+
+		expectEquals(numMetadata, 1, "thread metadata missing");
+		expectEquals(names.joinIntoString(","), String("TestScope42,Unknown scope 3"), "wrong names");
+
+		auto json = JSON::toString(trace);
+		expect(JSON::parse(json).isObject(), "invalid JSON");
+
+		t.clear();
+	}
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LightweightTracerTests);
+};
+
+static LightweightTracerTests lightweightTracerTests;
+
+} // namespace hise
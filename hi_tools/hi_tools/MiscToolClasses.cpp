@@ -385,6 +385,11 @@ void ComplexDataUIBase::SourceWatcher::removeSourceListener(SourceListener* l)
 	listeners.removeAllInstancesOf(l);
 }
 
+ComplexDataUIBase::ComplexDataUIBase()
+{
+	internalUpdater.snapshotSource = this;
+}
+
 ComplexDataUIBase::~ComplexDataUIBase()
 {}
 
@@ -415,6 +420,99 @@ UndoManager* ComplexDataUIBase::getUndoManager(bool useUndoManager)
 hise::SimpleReadWriteLock& ComplexDataUIBase::getDataLock() const
 { return dataLock; }
 
+void ComplexDataUIBase::setEnableSnapshotPublishing(bool shouldPublishSnapshots)
+{
+	if (shouldPublishSnapshots == isSnapshotPublishingEnabled())
+		return;
+
+	if (shouldPublishSnapshots)
+	{
+		DataSnapshot s;
+
+		if (!fillSnapshot(s))
+		{
+			// This data type doesn't support snapshots
+			jassertfalse;
+			return;
+		}
+
+		if (snapshotUpdater == nullptr)
+			snapshotUpdater = new SnapshotUpdater(*this, internalUpdater.getGlobalUIUpdater());
+
+		snapshotPublishingEnabled.store(true);
+		sendSnapshotUpdate();
+	}
+	else
+	{
+		// The readers will fall back to the lock
+		snapshotPublishingEnabled.store(false);
+		snapshotPublisher.publish(nullptr);
+	}
+}
+
+void ComplexDataUIBase::publishSnapshot()
+{
+	jassert(MessageManager::existsAndIsCurrentThread());
+
+	if (!isSnapshotPublishingEnabled())
+		return;
+
+	ScopedPointer<DataSnapshot> s = new DataSnapshot();
+
+	{
+		SimpleReadWriteLock::ScopedReadLock sl(dataLock);
+
+		// Publish an empty slot so that the readers don't keep using outdated data
+		if (!fillSnapshot(*s))
+			s = nullptr;
+	}
+
+	snapshotPublisher.publish(s.release());
+}
+
+void ComplexDataUIBase::sendSnapshotUpdate()
+{
+	if (!isSnapshotPublishingEnabled())
+		return;
+
+	// The content change can be sent from the audio thread, so we must not allocate the copy there
+	if (MessageManager::existsAndIsCurrentThread())
+		publishSnapshot();
+	else
+		snapshotUpdater->trigger();
+}
+
+ComplexDataUIBase::SnapshotUpdater::SnapshotUpdater(ComplexDataUIBase& parent_, PooledUIUpdater* updater) :
+	SimpleTimer(updater, updater != nullptr),
+	parent(parent_)
+{}
+
+ComplexDataUIBase::SnapshotUpdater::~SnapshotUpdater()
+{
+	cancelPendingUpdate();
+}
+
+void ComplexDataUIBase::SnapshotUpdater::timerCallback()
+{
+	if (dirty.exchange(false))
+		parent.publishSnapshot();
+}
+
+void ComplexDataUIBase::SnapshotUpdater::handleAsyncUpdate()
+{
+	dirty.store(false);
+	parent.publishSnapshot();
+}
+
+void ComplexDataUIBase::SnapshotUpdater::trigger()
+{
+	dirty.store(true);
+
+	// Without a pooled updater we need to use the message queue
+	if (!isTimerRunning())
+		triggerAsyncUpdate();
+}
+
 bool FuzzySearcher::fitsSearch(const String &searchTerm, const String &stringToMatch, double fuzzyness)
 {
 	if (stringToMatch.contains(searchTerm))
@@ -1784,6 +1882,9 @@ bool PooledUIUpdater::SimpleTimer::isTimerRunning() const
 
 void PooledUIUpdater::SimpleTimer::setEnableProfiling(const String& profileName)
 {
+	stats.name = profileName;
+	recordStatistics = profileName.isNotEmpty();
+
 #if HISE_INCLUDE_PROFILING_TOOLKIT
 	using PD = DebugSession::ProfileDataSource;
 
@@ -1849,63 +1950,75 @@ void PooledUIUpdater::timerCallback()
 
 	TRACE_DISPATCH("UI Timer callback");
 
+	auto frameStart = Time::getMillisecondCounterHiRes();
+
+	auto isOverBudget = [&]()
+	{
+		return frameBudgetMilliseconds > 0.0 && (Time::getMillisecondCounterHiRes() - frameStart) > frameBudgetMilliseconds;
+	};
+
 	{
 		PROFILE_ONLY(DebugSession::ProfileDataSource::ScopedProfiler sp((debugSession != nullptr && debugSession->isRecordingMultithread()) ? dynamic_cast<DebugSession::ProfileDataSource*>(timerSession.get()) : nullptr, debugSession));
 
 		ScopedLock sl(simpleTimers.getLock());
 
-#if MEASURE_TIMER_CHILDREN
-		auto now = Time::getMillisecondCounterHiRes();
-#endif
-
 		for (int i = 0; i < simpleTimers.size(); i++)
 		{
-			auto st = simpleTimers[i];
+			if (auto st = simpleTimers[i].get())
+			{
+				// timers that were skipped too often will be called in the first pass
+				st->currentPass = st->numSkippedFrames >= MaxNumSkippedFrames ? 0 : (int)st->priority;
+			}
+			else
+				simpleTimers.remove(i--);
+		}
 
-			if (st.get() != nullptr)
+		for (int pass = 0; pass < (int)SimpleTimer::Priority::numPriorities; pass++)
+		{
+			for (int i = 0; i < simpleTimers.size(); i++)
 			{
-#if HISE_INCLUDE_PROFILING_TOOLKIT
-				if(debugSession != nullptr && debugSession->isRecordingMultithread())
-				{
-					if(auto pd = st->getProfileDataSource<DebugSession::ProfileDataSource>())
-					{
-						DebugSession::ProfileDataSource::ScopedProfiler sp(pd, debugSession);
-						st->timerCallback();
-						continue;
-					}
-				}
-#endif
+				auto st = simpleTimers[i].get();
 
-#if MEASURE_TIMER_CHILDREN
-                auto before = Time::getMillisecondCounterHiRes();
-                
-                st->timerCallback();
-                
-				auto timerDuration = Time::getMillisecondCounterHiRes() - before;
+				if (st == nullptr || st->currentPass != pass)
+					continue;
 
-				if(lastDuration != 0.0 && st->getProfileDataSource<DebugSession::ProfileDataSource>() == nullptr)
+				if (st->skipIfHidden && isHiddenByParent(dynamic_cast<Component*>(st)))
 				{
-					auto relative = timerDuration / lastDuration;
-					auto threshold = JUCE_LIVE_CONSTANT(0.05);
+					st->stats.numHidden++;
+					continue;
+				}
 
-					if(relative > threshold)
-					{
-						int x = 5;
-					}
+				if (pass != 0 && isOverBudget())
+				{
+					st->numSkippedFrames++;
+					st->stats.numSkipped++;
+					continue;
 				}
-#else
-                st->timerCallback();
-#endif
+
+				st->numSkippedFrames = 0;
+				callTimer(*st);
 			}
-			else
-				simpleTimers.remove(i--);
 		}
+	}
 
-#if MEASURE_TIMER_CHILDREN
-		lastDuration = Time::getMillisecondCounterHiRes() - now;
-#endif
+	for (int i = 0; i < deferredMessages.size(); i++)
+	{
+		auto b = deferredMessages.getReference(i).first.get();
+		auto l = deferredMessages.getReference(i).second.get();
+
+		if (b == nullptr || l == nullptr)
+			deferredMessages.remove(i--);
+		else if (!isHiddenByParent(dynamic_cast<Component*>(l)))
+		{
+			deferredMessages.remove(i--);
+			l->handlePooledMessage(b);
+		}
 	}
 
+	// If the messages were delayed in the last frame, we'll send all of them now
+	auto ignoreBudget = messagesWereDelayed;
+	messagesWereDelayed = false;
+
 	WeakReference<Broadcaster> b;
 
 	while (pendingHandlers.pop(b))
@@ -1917,10 +2030,98 @@ void PooledUIUpdater::timerCallback()
 			for (auto l : b->pooledListeners)
 			{
 				if (l != nullptr)
-					l->handlePooledMessage(b);
+					sendPooledMessage(b, l);
 			}
 		}
+
+		if (!ignoreBudget && isOverBudget())
+		{
+			messagesWereDelayed = true;
+			break;
+		}
+	}
+}
+
+Array<PooledUIUpdater::TimerStatistics> PooledUIUpdater::getTimerStatistics() const
+{
+	Array<TimerStatistics> list;
+
+	ScopedLock sl(simpleTimers.getLock());
+
+	for (auto st : simpleTimers)
+	{
+		if (st != nullptr && st->recordStatistics)
+			list.add(st->stats);
+	}
+
+	return list;
+}
+
+void PooledUIUpdater::resetTimerStatistics()
+{
+	ScopedLock sl(simpleTimers.getLock());
+
+	for (auto st : simpleTimers)
+	{
+		if (st != nullptr)
+		{
+			auto name = st->stats.name;
+			st->stats = {};
+			st->stats.name = name;
+		}
+	}
+}
+
+bool PooledUIUpdater::isHiddenByParent(Component* c) const
+{
+	// A component that is not visible itself will still be called (it might want to show itself)
+	return skipHiddenComponents && c != nullptr && c->isVisible() && !c->isShowing();
+}
+
+void PooledUIUpdater::callTimer(SimpleTimer& st)
+{
+#if HISE_INCLUDE_PROFILING_TOOLKIT
+	if(debugSession != nullptr && debugSession->isRecordingMultithread())
+	{
+		if(auto pd = st.getProfileDataSource<DebugSession::ProfileDataSource>())
+		{
+			DebugSession::ProfileDataSource::ScopedProfiler sp(pd, debugSession);
+			st.timerCallback();
+			return;
+		}
+	}
+#endif
+
+	if (st.recordStatistics)
+	{
+		WeakReference<SimpleTimer> safeTimer(&st);
+
+		auto before = Time::getMillisecondCounterHiRes();
+
+		st.timerCallback();
+
+		auto duration = Time::getMillisecondCounterHiRes() - before;
+
+		// the timer might have deleted itself in the callback
+		if (safeTimer != nullptr)
+		{
+			st.stats.numCallbacks++;
+			st.stats.totalMilliseconds += duration;
+			st.stats.peakMilliseconds = jmax(st.stats.peakMilliseconds, duration);
+		}
 	}
+	else
+	{
+		st.timerCallback();
+	}
+}
+
+void PooledUIUpdater::sendPooledMessage(Broadcaster* b, Listener* l)
+{
+	if (isHiddenByParent(dynamic_cast<Component*>(l)))
+		deferredMessages.addIfNotAlreadyThere({ b, l });
+	else
+		l->handlePooledMessage(b);
 }
 
 ComplexDataUIUpdaterBase::EventListener::~EventListener()
@@ -1975,11 +2176,17 @@ void ComplexDataUIUpdaterBase::sendDisplayChangeMessage(float newIndexValue, Not
 
 void ComplexDataUIUpdaterBase::sendContentChangeMessage(NotificationType notify, int indexThatChanged)
 {
+	if (snapshotSource != nullptr)
+		snapshotSource->sendSnapshotUpdate();
+
 	sendMessageToListeners(EventType::ContentChange, var(indexThatChanged), notify, true);
 }
 
 void ComplexDataUIUpdaterBase::sendContentRedirectMessage()
 {
+	if (snapshotSource != nullptr)
+		snapshotSource->sendSnapshotUpdate();
+
 	sendMessageToListeners(EventType::ContentRedirected, {}, sendNotificationSync, true);
 }
 
@@ -654,14 +654,15 @@ private:
 
 class DebugSession;
 
-// Set this to 1 to find out the timer children that take the most time so you can add profile infos to it.
-#ifndef MEASURE_TIMER_CHILDREN
-#define MEASURE_TIMER_CHILDREN 0
-#endif
-
 /** Coallescates timer updates.
 	@ingroup event_handling
 	
+	A timer or listener that is a component will not be called while it's visible but hidden
+	by one of its parents (eg. on an inactive tab page). Pending messages for hidden listeners
+	are delivered as soon as the component is showing again.
+
+	If you set a frame budget, the timers will be called in the order of their priority and
+	the normal / low priority timers will be skipped if the budget is exceeded.
 */
 class PooledUIUpdater : public SuspendableTimer
 {
@@ -669,6 +670,17 @@ public:
 
 	PooledUIUpdater();
 
+	/** The statistics of a timer that has a profile name. */
+	struct TimerStatistics
+	{
+		String name;
+		int numCallbacks = 0;				// the amount of timer callbacks
+		int numSkipped = 0;					// the amount of frames that were skipped because of the budget
+		int numHidden = 0;					// the amount of frames that were skipped because the component wasn't showing
+		double totalMilliseconds = 0.0;		// the time spent in the timer callback
+		double peakMilliseconds = 0.0;		// the longest timer callback
+	};
+
 	class Broadcaster;
 
 	class Listener
@@ -701,10 +713,33 @@ public:
 
 		template <typename T> T* getProfileDataSource() { return dynamic_cast<T*>(profileData.get()); }
 
+		/** Enables the profiling of this timer. This will record the TimerStatistics and create a
+		    profile data source for the DebugSession if the profiling toolkit is enabled. */
 		void setEnableProfiling(const String& profileName);
 
+		enum class Priority
+		{
+			High,	///< will always be called, even if the frame budget is exceeded
+			Normal,
+			Low,	///< will be called last and skipped first
+			numPriorities
+		};
+
+		/** Sets the priority that is used when the updater has a frame budget. */
+		void setPriority(Priority newPriority) { priority = newPriority; }
+
+		Priority getPriority() const { return priority; }
+
+		/** By default a timer that is a component will be skipped while it's hidden by one of its parents. */
+		void setSkipIfHidden(bool shouldSkip) { skipIfHidden = shouldSkip; }
+
+		/** Returns the statistics since the last call to PooledUIUpdater::resetTimerStatistics(). */
+		const TimerStatistics& getStatistics() const { return stats; }
+
 	private:
 
+		friend class PooledUIUpdater;
+
 		ReferenceCountedObjectPtr<ReferenceCountedObject> profileData;
 
 		void startOrStop(bool shouldStart);
@@ -713,6 +748,15 @@ public:
 
 		bool isRunning = false;
 		WeakReference<PooledUIUpdater> updater;
+
+		Priority priority = Priority::Normal;
+		bool skipIfHidden = true;
+		bool recordStatistics = false;
+
+		int numSkippedFrames = 0;
+		int currentPass = 0;
+
+		TimerStatistics stats;
 	};
 
 	class Broadcaster
@@ -750,12 +794,34 @@ public:
 
 	DebugSession* getDebugSession() { return debugSession; }
 
+	/** Sets the time that the timer callbacks may use per frame. Zero disables the budget (the default). */
+	void setFrameBudget(double milliseconds) { frameBudgetMilliseconds = jmax(0.0, milliseconds); }
+
+	/** Enables the check whether timers and listeners are hidden by their parent component (enabled by default). */
+	void setSkipHiddenComponents(bool shouldSkip) { skipHiddenComponents = shouldSkip; }
+
+	/** Returns the statistics of all running timers that have a profile name. */
+	Array<TimerStatistics> getTimerStatistics() const;
+
+	void resetTimerStatistics();
+
 private:
 
+	/** A timer that is skipped this many frames in a row will be called with the high priority. */
+	static constexpr int MaxNumSkippedFrames = 8;
+
+	bool isHiddenByParent(Component* c) const;
+
+	void callTimer(SimpleTimer& st);
+
+	void sendPooledMessage(Broadcaster* b, Listener* l);
+
+	double frameBudgetMilliseconds = 0.0;
+	bool skipHiddenComponents = true;
+	bool messagesWereDelayed = false;
+
+	Array<std::pair<WeakReference<Broadcaster>, WeakReference<Listener>>> deferredMessages;
 
-#if MEASURE_TIMER_CHILDREN
-	double lastDuration = 0.0;
-#endif
 
 	hise::DebugSession* debugSession = nullptr;
 	ReferenceCountedObjectPtr<ReferenceCountedObject> timerSession;
@@ -769,6 +835,8 @@ private:
 
 
 
+struct ComplexDataUIBase;
+
 /** This class is used by multiple complex UI classes to handle the notification and updates. 
 
 	There are three main events that can happen with complex data types:
@@ -781,6 +849,8 @@ private:
 */
 class ComplexDataUIUpdaterBase
 {
+	friend struct ComplexDataUIBase;
+
 public:
 
 	enum class EventType
@@ -858,6 +928,8 @@ private:
 
 	static constexpr int NumListenerSlots = 128;
 	hise::UnorderedStack<WeakReference<EventListener>, NumListenerSlots> listeners;
+
+	ComplexDataUIBase* snapshotSource = nullptr;
 };
 
 
@@ -1908,6 +1980,8 @@ struct ComplexDataUIBase : public ReferenceCountedObject
 		WeakReference<ComplexDataUIBase> currentSource;
 	};
 
+	ComplexDataUIBase();
+
 	virtual ~ComplexDataUIBase();;
 
 	virtual void setGlobalUIUpdater(PooledUIUpdater* updater);
@@ -1931,12 +2005,69 @@ struct ComplexDataUIBase : public ReferenceCountedObject
 		getUpdater().setEnableProfiling(profileName);
 	}
 
+	/** An immutable copy of the data that is published in the snapshot mode. */
+	struct DataSnapshot
+	{
+		AudioSampleBuffer buffer;
+	};
+
+	using SnapshotPublisherType = SnapshotPublisher<DataSnapshot>;
+
+	/** Enables the snapshot publication mode (only tables support this at the moment).
+
+		If enabled, every content change will create a copy of the data and publish it
+		so that a reader on the audio thread can pin the most recent snapshot without 
+		waiting for the data lock. The copy is always created on the message thread, so
+		a change from another thread will be published asynchronously.
+	*/
+	void setEnableSnapshotPublishing(bool shouldPublishSnapshots);
+
+	bool isSnapshotPublishingEnabled() const { return snapshotPublishingEnabled.load(); }
+
+	/** Creates a copy of the current data and publishes it. This must be called on the message thread. */
+	void publishSnapshot();
+
+	/** Returns the publisher if the snapshot mode is enabled or nullptr. */
+	const SnapshotPublisherType* getSnapshotPublisher() const { return isSnapshotPublishingEnabled() ? &snapshotPublisher : nullptr; }
+
 protected:
 
+	/** Override this method and copy the current data into the snapshot. Return false if the data type doesn't support snapshots. */
+	virtual bool fillSnapshot(DataSnapshot& s) const { ignoreUnused(s); return false; }
+
+	/** Publishes the snapshot directly on the message thread or defers it to the SnapshotUpdater. 
+	
+		This is called for every content change message, but if the data is updated after the 
+		message was sent, you need to call it again. */
+	void sendSnapshotUpdate();
+
 	ComplexDataUIUpdaterBase internalUpdater;
 
 private:
 
+	friend class ComplexDataUIUpdaterBase;
+
+	/** Rebuilds the snapshot on the message thread after a change from another thread. */
+	struct SnapshotUpdater : public PooledUIUpdater::SimpleTimer,
+							 public AsyncUpdater
+	{
+		SnapshotUpdater(ComplexDataUIBase& parent_, PooledUIUpdater* updater);
+		~SnapshotUpdater();
+
+		void timerCallback() override;
+		void handleAsyncUpdate() override;
+
+		void trigger();
+
+		ComplexDataUIBase& parent;
+		std::atomic<bool> dirty = { false };
+	};
+
+	// The publisher stays alive as long as this object so that a reader never sees a dangling pointer
+	SnapshotPublisherType snapshotPublisher;
+	ScopedPointer<SnapshotUpdater> snapshotUpdater;
+	std::atomic<bool> snapshotPublishingEnabled = { false };
+
 	mutable hise::SimpleReadWriteLock dataLock;
 
 	UndoManager* undoManager = nullptr;
@@ -0,0 +1,128 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   ===========================================================================
+*/
+
+namespace hise {
+using namespace juce;
+
+class PeakPyramidTests : public UnitTest
+{
+public:
+
+	PeakPyramidTests() : UnitTest("PeakPyramid Tests", "Misc Tools") {}
+
+	void runTest() override
+	{
+		testLevels();
+		testSidecarFile();
+	}
+
+private:
+
+	AudioSampleBuffer createTestBuffer(int numSamples)
+	{
+		AudioSampleBuffer b(2, numSamples);
+
+		Random r(1234);
+
+		for (int i = 0; i < numSamples; i++)
+		{
+			b.setSample(0, i, r.nextFloat() * 2.0f - 1.0f);
+			b.setSample(1, i, 0.5f * std::sin((float)i * 0.01f));
+		}
+
+		return b;
+	}
+
+	void testLevels()
+	{
+		beginTest("Pyramid levels contain the peaks");
+
+		auto b = createTestBuffer(100000);
+		auto p = PeakPyramid::createFromBuffer(b);
+
+		expect(p != nullptr, "pyramid wasn't created");
+		expectEquals(p->getNumSamples(), (int64)b.getNumSamples(), "wrong sample amount");
+
+		for (int c = 0; c < 2; c++)
+		{
+			auto all = p->getLevels(c, { 0, b.getNumSamples() });
+			auto expected = b.findMinMax(c, 0, b.getNumSamples());
+
+			expectEquals(all.minValue, expected.getStart(), "wrong minimum");
+			expectEquals(all.maxValue, expected.getEnd(), "wrong maximum");
+			expectWithinAbsoluteError(all.rms, b.getRMSLevel(c, 0, b.getNumSamples()), 0.01f, "wrong RMS");
+
+			// The entries are aligned to the blocks, so they must include the exact range
+			Range<int64> sub(1000, 5000);
+			auto subLevels = p->getLevels(c, sub);
+			auto subExpected = b.findMinMax(c, 1000, 4000);
+
+			expect(subLevels.minValue <= subExpected.getStart(), "range minimum missing");
+			expect(subLevels.maxValue >= subExpected.getEnd(), "range maximum missing");
+		}
+
+		expectEquals(p->getLevels(0, { 200000, 300000 }).maxValue, 0.0f, "out of range must be empty");
+	}
+
+	void testSidecarFile()
+	{
+		beginTest("Sidecar file");
+
+		auto dir = File::getSpecialLocation(File::tempDirectory).getChildFile("PeakPyramidTest");
+		dir.createDirectory();
+
+		auto source = dir.getChildFile("source.dat");
+		source.replaceWithText("Some audio data");
+
+		auto b = createTestBuffer(10000);
+		auto p = PeakPyramid::createFromBuffer(b);
+
+		auto cacheFile = PeakPyramid::getSidecarFile(source, 1024);
+
+		expect(p->writeToFile(cacheFile, source), "writing failed");
+
+		{
+			auto loaded = PeakPyramid::loadFromFile(cacheFile, source, b.getNumSamples());
+
+			expect(loaded != nullptr, "loading failed");
+
+			auto e1 = p->getLevels(1, { 300, 9000 });
+			auto e2 = loaded->getLevels(1, { 300, 9000 });
+
+			expectEquals(e1.minValue, e2.minValue, "minimum mismatch");
+			expectEquals(e1.maxValue, e2.maxValue, "maximum mismatch");
+			expectEquals(e1.rms, e2.rms, "RMS mismatch");
+
+			expect(PeakPyramid::loadFromFile(cacheFile, source, 20000) == nullptr, "sample amount mismatch must be rejected");
+		}
+
+		source.replaceWithText("Some changed audio data");
+		expect(PeakPyramid::loadFromFile(cacheFile, source, b.getNumSamples()) == nullptr, "changed source file must be rejected");
+
+		dir.deleteRecursively();
+	}
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PeakPyramidTests);
+};
+
+static PeakPyramidTests peakPyramidTests;
+
+} // namespace hise
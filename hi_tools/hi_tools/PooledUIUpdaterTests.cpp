@@ -0,0 +1,171 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   ===========================================================================
+*/
+
+namespace hise {
+using namespace juce;
+
+class PooledUIUpdaterTests : public UnitTest
+{
+public:
+
+	PooledUIUpdaterTests() : UnitTest("PooledUIUpdater Tests", "Misc Tools") {}
+
+	void runTest() override
+	{
+		// The timers are registered synchronously only if we're on the message thread
+		if (!MessageManager::getInstance()->currentThreadHasLockedMessageManager())
+		{
+			logMessage("Skipping PooledUIUpdater tests (not on the message thread)");
+			return;
+		}
+
+		testPriorities();
+		testHiddenComponents();
+		testStatistics();
+	}
+
+private:
+
+	struct TestTimer : public PooledUIUpdater::SimpleTimer
+	{
+		TestTimer(PooledUIUpdater* u, double durationMs_ = 0.0) :
+			SimpleTimer(u),
+			durationMs(durationMs_)
+		{}
+
+		void timerCallback() override
+		{
+			auto start = Time::getMillisecondCounterHiRes();
+
+			while (Time::getMillisecondCounterHiRes() - start < durationMs)
+				;
+
+			numCallbacks++;
+		}
+
+		const double durationMs;
+		int numCallbacks = 0;
+	};
+
+	struct TestComponent : public Component,
+						   public PooledUIUpdater::SimpleTimer
+	{
+		TestComponent(PooledUIUpdater* u) :
+			SimpleTimer(u)
+		{}
+
+		void timerCallback() override { numCallbacks++; }
+
+		int numCallbacks = 0;
+	};
+
+	void testPriorities()
+	{
+		beginTest("Priorities with frame budget");
+
+		PooledUIUpdater updater;
+		updater.stopTimer();
+		updater.setFrameBudget(1.0);
+
+		TestTimer high(&updater, 2.0);
+		TestTimer normal(&updater);
+		TestTimer low(&updater);
+
+		high.setPriority(PooledUIUpdater::SimpleTimer::Priority::High);
+		low.setPriority(PooledUIUpdater::SimpleTimer::Priority::Low);
+
+		updater.timerCallback();
+
+		expectEquals(high.numCallbacks, 1, "high priority timer must always be called");
+		expectEquals(normal.numCallbacks, 0, "normal priority timer must be skipped");
+		expectEquals(low.numCallbacks, 0, "low priority timer must be skipped");
+
+		for (int i = 0; i < 8; i++)
+			updater.timerCallback();
+
+		expectEquals(normal.numCallbacks, 1, "skipped timers must be called eventually");
+		expectEquals(low.numCallbacks, 1, "skipped timers must be called eventually");
+
+		updater.setFrameBudget(0.0);
+		updater.timerCallback();
+
+		expectEquals(low.numCallbacks, 2, "timers must not be skipped without budget");
+	}
+
+	void testHiddenComponents()
+	{
+		beginTest("Skip hidden components");
+
+		PooledUIUpdater updater;
+		updater.stopTimer();
+
+		Component parent;
+		TestComponent child(&updater);
+		parent.addAndMakeVisible(child);
+
+		// the parent is not visible so the child is hidden
+		updater.timerCallback();
+		expectEquals(child.numCallbacks, 0, "hidden child must be skipped");
+
+		// a component that hides itself must still be called
+		child.setVisible(false);
+		updater.timerCallback();
+		expectEquals(child.numCallbacks, 1, "invisible component must be called");
+
+		child.setVisible(true);
+		updater.setSkipHiddenComponents(false);
+		updater.timerCallback();
+		expectEquals(child.numCallbacks, 2, "visibility check must be disabled");
+	}
+
+	void testStatistics()
+	{
+		beginTest("Timer statistics");
+
+		PooledUIUpdater updater;
+		updater.stopTimer();
+
+		TestTimer t(&updater, 1.0);
+		TestTimer unnamed(&updater);
+
+		t.setEnableProfiling("Test Timer");
+
+		for (int i = 0; i < 3; i++)
+			updater.timerCallback();
+
+		auto list = updater.getTimerStatistics();
+
+		expectEquals(list.size(), 1, "only timers with a profile name must be listed");
+		expectEquals(list[0].name, String("Test Timer"), "wrong name");
+		expectEquals(list[0].numCallbacks, 3, "wrong callback count");
+		expect(list[0].totalMilliseconds >= 3.0, "wrong duration");
+		expect(list[0].peakMilliseconds >= 1.0, "wrong peak duration");
+
+		updater.resetTimerStatistics();
+		expectEquals(updater.getTimerStatistics()[0].numCallbacks, 0, "reset doesn't work");
+	}
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PooledUIUpdaterTests);
+};
+
+static PooledUIUpdaterTests pooledUIUpdaterTests;
+
+} // namespace hise
@@ -0,0 +1,196 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   ===========================================================================
+*/
+
+namespace hise {
+using namespace juce;
+
+class SnapshotPublisherTests : public UnitTest
+{
+public:
+
+	SnapshotPublisherTests() : UnitTest("SnapshotPublisher Tests", "Misc Tools") {}
+
+	void runTest() override
+	{
+		testPinning();
+		testConcurrentReaders();
+		testComplexDataSnapshots();
+	}
+
+private:
+
+	struct TestData
+	{
+		TestData(int v)
+		{
+			for (auto& s : values)
+				s = v;
+		}
+
+		bool isConsistent() const
+		{
+			for (auto s : values)
+			{
+				if (s != values[0])
+					return false;
+			}
+
+			return true;
+		}
+
+		int values[64];
+	};
+
+	using Publisher = SnapshotPublisher<TestData>;
+
+	void testPinning()
+	{
+		beginTest("Pinned snapshots are not deleted");
+
+		Publisher p;
+
+		{
+			Publisher::ScopedReader r(p);
+			expect(!r, "empty publisher must not return a snapshot");
+		}
+
+		p.publish(new TestData(1));
+
+		{
+			Publisher::ScopedReader r(p);
+			expect(r && r->values[0] == 1, "first snapshot not published");
+
+			p.publish(new TestData(2));
+			p.collectGarbage();
+
+			expectEquals(p.getNumPendingSnapshots(), 1, "pinned snapshot was deleted");
+			expectEquals(r->values[0], 1, "pinned snapshot was changed");
+
+			Publisher::ScopedReader r2(p);
+			expectEquals(r2->values[0], 2, "new reader doesn't see the new snapshot");
+		}
+
+		p.collectGarbage();
+		expectEquals(p.getNumPendingSnapshots(), 0, "retired snapshot wasn't deleted");
+	}
+
+	struct Reader : public Thread
+	{
+		Reader(Publisher& p_) :
+			Thread("Snapshot Reader"),
+			p(p_)
+		{}
+
+		void run() override
+		{
+			while (!threadShouldExit())
+			{
+				Publisher::ScopedReader r(p);
+
+				if (r)
+				{
+					numReads++;
+
+					if (!r->isConsistent())
+						numErrors++;
+				}
+			}
+		}
+
+		Publisher& p;
+		std::atomic<int> numReads = { 0 };
+		std::atomic<int> numErrors = { 0 };
+	};
+
+	void testConcurrentReaders()
+	{
+		beginTest("Concurrent readers");
+
+		Publisher p;
+		p.publish(new TestData(0));
+
+		OwnedArray<Reader> readers;
+
+		for (int i = 0; i < 3; i++)
+			readers.add(new Reader(p))->startThread();
+
+		for (int i = 1; i < 2000; i++)
+		{
+			p.publish(new TestData(i));
+
+			if (i % 16 == 0)
+				p.collectGarbage();
+		}
+
+		for (auto r : readers)
+			r->stopThread(1000);
+
+		for (auto r : readers)
+		{
+			expect(r->numReads.load() > 0, "reader didn't read anything");
+			expectEquals(r->numErrors.load(), 0, "reader accessed a modified snapshot");
+		}
+
+		p.collectGarbage();
+		p.collectGarbage();
+		expectEquals(p.getNumPendingSnapshots(), 0, "not all snapshots were deleted");
+	}
+
+	void testComplexDataSnapshots()
+	{
+		beginTest("Table snapshots");
+
+		SampleLookupTable d;
+		d.setEnableSnapshotPublishing(true);
+
+		d.addTablePoint(0.5f, 0.25f);
+
+		auto expectMatchingSnapshot = [&](const String& message)
+		{
+			ComplexDataUIBase::SnapshotPublisherType::ScopedReader r(d.getSnapshotPublisher());
+
+			expect((bool)r, "no snapshot " + message);
+
+			if (r)
+			{
+				expectEquals(r->buffer.getNumSamples(), d.getTableSize(), "wrong table size " + message);
+
+				auto middle = d.getTableSize() / 2;
+				expectEquals(r->buffer.getSample(0, middle), d.getReadPointer()[middle], "wrong table value " + message);
+			}
+		};
+
+		expectMatchingSnapshot("after adding a point");
+
+		d.setEnableSnapshotPublishing(false);
+		expect(d.getSnapshotPublisher() == nullptr, "snapshot mode wasn't disabled");
+
+		d.reset();
+		d.setEnableSnapshotPublishing(true);
+		expectMatchingSnapshot("after enabling it again");
+	}
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SnapshotPublisherTests);
+};
+
+static SnapshotPublisherTests snapshotPublisherTests;
+
+} // namespace hise
@@ -385,6 +385,15 @@ String Table::toBase64String() const
 	return exportData();
 }
 
+bool Table::fillSnapshot(DataSnapshot& s) const
+{
+	auto numValues = getTableSize();
+
+	s.buffer.setSize(1, numValues);
+	FloatVectorOperations::copy(s.buffer.getWritePointer(0), getReadPointer(), numValues);
+	return true;
+}
+
 void Table::createPath(Path &normalizedPath, bool fillPath, bool addStartEnd) const
 {
 	normalizedPath.clear();
@@ -454,6 +463,9 @@ void Table::fillLookUpTable()
 	fillExternalLookupTable(newValues, getTableSize());
 	
     FloatVectorOperations::copy(getWritePointer(), newValues, getTableSize());
+
+	// most callers send the content change message before the lookup table is refilled
+	sendSnapshotUpdate();
 };
 
 void Table::fillExternalLookupTable(float* d, int numValues)
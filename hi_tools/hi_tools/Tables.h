@@ -134,6 +134,8 @@ public:
 
 	String toBase64String() const override;
 
+	bool fillSnapshot(DataSnapshot& s) const override;
+
 	
 
 	/** Restores the data from a base64 encoded String.
@@ -0,0 +1,106 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   ===========================================================================
+*/
+
+namespace hise {
+using namespace juce;
+
+class XYZPoolTests : public UnitTest
+{
+public:
+
+	XYZPoolTests() : UnitTest("XYZPool Tests", "Misc Tools") {}
+
+	void runTest() override
+	{
+		testIndex();
+	}
+
+private:
+
+	using Item = MultiChannelAudioBuffer::XYZItem;
+
+	Item createItem(Range<int> keys, Range<int> velos, int rr)
+	{
+		Item i;
+		i.keyRange = keys;
+		i.veloRange = velos;
+		i.root = keys.getStart();
+		i.rrGroup = rr;
+		return i;
+	}
+
+	int getLinearIndex(const Item::List& items, int n, int v, int r)
+	{
+		for (int i = 0; i < items.size(); i++)
+		{
+			if (items.getReference(i).matches(n, v, r))
+				return i;
+		}
+
+		return -1;
+	}
+
+	void testIndex()
+	{
+		beginTest("XYZ index matches the linear search");
+
+		Random rng(4711);
+		Item::List items;
+
+		for (int i = 0; i < 200; i++)
+		{
+			auto k = rng.nextInt(120);
+			auto v = rng.nextInt(120);
+			items.add(createItem({ k, k + 1 + rng.nextInt(8) }, { v, v + 1 + rng.nextInt(30) }, 1 + rng.nextInt(4)));
+		}
+
+		MultiChannelAudioBuffer::XYZIndex index;
+		index.rebuild(items);
+
+		int numErrors = 0;
+
+		for (int r = 0; r < 6; r++)
+		{
+			for (int n = -1; n < 130; n++)
+			{
+				for (int v = -1; v < 130; v++)
+				{
+					if (index.getIndex(items, n, v, r) != getLinearIndex(items, n, v, r))
+						numErrors++;
+				}
+			}
+		}
+
+		expectEquals(numErrors, 0, "index mismatch");
+
+		// Too many RR groups will fall back to the linear search
+		items.add(createItem({ 60, 61 }, { 0, 128 }, 1000));
+		index.rebuild(items);
+
+		expectEquals(index.getIndex(items, 60, 64, 1000), items.size() - 1, "linear fallback doesn't work");
+	}
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(XYZPoolTests);
+};
+
+static XYZPoolTests xyzPoolTests;
+
+} // namespace hise
@@ -70,6 +70,11 @@
 #if HI_RUN_UNIT_TESTS
 #include "hi_tools/FuzzySearcherTests.cpp"
 #include "hi_tools/SemanticVersionCheckerTests.cpp"
+#include "hi_tools/LightweightTracerTests.cpp"
+#include "hi_tools/PooledUIUpdaterTests.cpp"
+#include "hi_tools/SnapshotPublisherTests.cpp"
+#include "hi_tools/PeakPyramidTests.cpp"
+#include "hi_tools/XYZPoolTests.cpp"
 #endif
 
 #include "hi_dispatch/hi_dispatch.cpp"
@@ -78,6 +83,7 @@
 #include "hi_tools/HI_LookAndFeels.cpp"
 
 #include "hi_tools/runtime_target.cpp"
+#include "hi_tools/LightweightTracer.cpp"
 
 #if !HISE_NO_GUI_TOOLS
 
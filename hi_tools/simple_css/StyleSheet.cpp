@@ -447,22 +447,23 @@ StyleSheet::Ptr StyleSheet::Collection::operator[](const Selector& s) const
 String StyleSheet::Collection::getDebugLogForComponent(Component* c) const
 {
 #if HISE_INCLUDE_CSS_DEBUG_TOOLS
-	for(auto& cm: cachedMaps)
+	auto it = cachedMaps.find(c);
+
+	if(it != cachedMaps.end() && it->second.first.getComponent() == c)
 	{
-		if(cm.first.getComponent() == c)
+		const auto& cm = it->second;
+
+		if(auto obj = cm.second != nullptr ? cm.second->varProperties.get() : nullptr)
 		{
-			if(auto obj = cm.second->varProperties.get())
-			{
-				String s;
-				s << "Current variable values:\n";
-				s << JSON::toString(var(obj));
-				s << "\n==============================\n\n";
+			String s;
+			s << "Current variable values:\n";
+			s << JSON::toString(var(obj));
+			s << "\n==============================\n\n";
 
-				s << cm.debugLog;
-				return s;
-			}
-			return cm.debugLog;
+			s << cm.debugLog;
+			return s;
 		}
+		return cm.debugLog;
 	}
 #endif
             
@@ -484,14 +485,136 @@ StyleSheet::Ptr StyleSheet::Collection::getForElementSelector(Component* c) cons
 	return nullptr;
 }
 
+void StyleSheet::Collection::SelectorIndex::update(const List& l)
+{
+	if(l == indexedList)
+		return;
+
+	indexedList = l;
+	universalEntries.clearQuick();
+	buckets.clear();
+	all = nullptr;
+
+	int order = 0;
+
+	for(auto ss: indexedList)
+	{
+		if(ss->getAtRuleName().isNotEmpty())
+			continue;
+
+		if(ss->isAll())
+		{
+			all = ss;
+			continue;
+		}
+
+		for(auto cs: ss->complexSelectors)
+		{
+			Entry e = { order++, cs, ss };
+
+			if(auto key = getKeySelector(*cs))
+				buckets[key.toString()].add(e);
+			else
+				universalEntries.add(e);
+		}
+	}
+}
+
+void StyleSheet::Collection::SelectorIndex::addCandidates(const Array<Selector>& componentSelectors, Array<Entry>& candidates) const
+{
+	for(const auto& s: componentSelectors)
+	{
+		// a wildcard selector matches every entry
+		if(s.type == SelectorType::All)
+		{
+			candidates.addArray(universalEntries);
+
+			for(const auto& b: buckets)
+				candidates.addArray(b.second);
+
+			break;
+		}
+
+		auto it = buckets.find(s.toString());
+
+		if(it != buckets.end())
+			candidates.addArray(it->second);
+	}
+
+	if(candidates.isEmpty())
+	{
+		candidates.addArray(universalEntries);
+		return;
+	}
+
+	candidates.addArray(universalEntries);
+
+	struct Sorter
+	{
+		static int compareElements(const Entry& e1, const Entry& e2)
+		{
+			return e1.order - e2.order;
+		}
+	} sorter;
+
+	candidates.sort(sorter);
+
+	// remove duplicates (if a component has the same selector twice)
+	for(int i = 1; i < candidates.size(); i++)
+	{
+		if(candidates.getReference(i).order == candidates.getReference(i-1).order)
+			candidates.remove(i--);
+	}
+}
+
+Selector StyleSheet::Collection::SelectorIndex::getKeySelector(const ComplexSelector& cs)
+{
+	// All selectors of the AND group must be present in the component, so we can pick
+	// the most specific one as key.
+	Selector key;
+
+	for(const auto& s: cs.thisSelectors.selectors)
+	{
+		switch(s.first.type)
+		{
+		case SelectorType::ID:
+			return s.first;
+		case SelectorType::Class:
+			if(key.type != SelectorType::Class)
+				key = s.first;
+			break;
+		case SelectorType::Type:
+			if(!key)
+				key = s.first;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return key;
+}
+
 StyleSheet::Ptr StyleSheet::Collection::getForComponent(Component* c)
 {
 	c = simple_css::FlexboxComponent::Helpers::getComponentForStyleSheet(c);
 
-	for(const auto& existing: cachedMaps)
+	StyleSheet::Ptr previousStyle;
+
+	auto existing = cachedMaps.find(c);
+
+	if(existing != cachedMaps.end())
 	{
-		if(existing.first.getComponent() == c)
-			return existing.second;
+		// the address might be reused by a new component
+		auto isSameComponent = existing->second.first.getComponent() == c;
+
+		if(isSameComponent && !existing->second.dirty)
+			return existing->second.second;
+
+		if(isSameComponent)
+			previousStyle = existing->second.second;
+
+		cachedMaps.erase(existing);
 	}
 
 	using Match = std::pair<ComplexSelector::Score, StyleSheet::Ptr>;
@@ -541,25 +664,22 @@ StyleSheet::Ptr StyleSheet::Collection::getForComponent(Component* c)
 	
 	auto selectors = ComplexSelector::getSelectorsForComponent(c);
 
-	auto addFromList = [&](List& listToUse)
+	Array<SelectorIndex::Entry> candidates;
+
+	auto addFromList = [&](const List& listToUse, SelectorIndex& index)
 	{
-		for(auto l: listToUse)
-		{
-			if(l->getAtRuleName().isNotEmpty())
-				continue;
+		index.update(listToUse);
 
-			if(l->isAll())
-			{
-				all = l;
-			}
-			else
-			{
-				for(auto cs: l->complexSelectors)
-				{
-					if(cs->matchesSelectors(selectors, pSelectors))
-						matches.add({ ComplexSelector::Score(cs, selectors), l });
-				}
-			}
+		if(index.all != nullptr)
+			all = index.all;
+
+		candidates.clearQuick();
+		index.addCandidates(selectors, candidates);
+
+		for(const auto& e: candidates)
+		{
+			if(e.selector->matchesSelectors(selectors, pSelectors))
+				matches.add({ ComplexSelector::Score(e.selector, selectors), e.styleSheet });
 		}
 	};
 
@@ -572,7 +692,7 @@ StyleSheet::Ptr StyleSheet::Collection::getForComponent(Component* c)
 			if(sameOrParent(cc.first.getComponent(), c))
 			{
 				propertiesToUse = cc.childProperties;
-				addFromList(cc.second);
+				addFromList(cc.second, cc.index);
 				break;
 			}
 		}
@@ -581,14 +701,14 @@ StyleSheet::Ptr StyleSheet::Collection::getForComponent(Component* c)
 	{
 		propertiesToUse = rootProperties;
 
-		addFromList(list);
+		addFromList(list, rootIndex);
 
 		for(auto& cc: childCollections)
 		{
 			auto p = cc.first.getComponent();
 			if(p != nullptr && p->isParentOf(c))
 			{
-				addFromList(cc.second);
+				addFromList(cc.second, cc.index);
 			}
 		}
 	}
@@ -599,10 +719,14 @@ StyleSheet::Ptr StyleSheet::Collection::getForComponent(Component* c)
 	auto customCode = elementStyle.isNotEmpty() || inlineStyle.isNotEmpty() || parentStyle != nullptr || all != nullptr;
 
 	if(matches.isEmpty() && !customCode)
+	{
+		cachedMaps[c] = { c, nullptr, {} };
 		return nullptr;
+	}
 	
 	if(matches.size() == 1 && !customCode && !useIsolatedCollections)
 	{
+		cachedMaps[c] = { c, matches.getFirst().second, {} };
 		return matches.getFirst().second;
 	}
 
@@ -775,7 +899,10 @@ StyleSheet::Ptr StyleSheet::Collection::getForComponent(Component* c)
 	ptr->setPropertyVariable("name", c->getName());
 	ptr->setCustomFonts(customFonts);
 
-	cachedMaps.add({ c, ptr, styleSheetLog });
+	if(previousStyle != nullptr)
+		ptr->copyVarProperties(previousStyle);
+
+	cachedMaps[c] = { c, ptr, styleSheetLog };
 
 	jassert(animator != nullptr);
 	ptr->animator = animator;
@@ -805,10 +932,16 @@ StyleSheet::Ptr StyleSheet::Collection::getWithAllStates(Component* c, const Sel
 {
 	c = simple_css::FlexboxComponent::Helpers::getComponentForStyleSheet(c);
 
-	for(const auto& existing: cachedMapForAllStates)
+	AllStatesKey key(c, { (int)s.type, s.name });
+
+	auto existing = cachedMapForAllStates.find(key);
+
+	if(existing != cachedMapForAllStates.end())
 	{
-		if(existing.first.second.exactMatch(s) && existing.first.first == c)
-			return existing.second;
+		if(c == nullptr || existing->second.first.getComponent() == c)
+			return existing->second.second;
+
+		cachedMapForAllStates.erase(existing);
 	}
 
 	auto wantsAll = s.type == SelectorType::All;
@@ -877,7 +1010,7 @@ StyleSheet::Ptr StyleSheet::Collection::getWithAllStates(Component* c, const Sel
 	for(auto m: matches)
 		ptr->copyPropertiesFrom(m, true);
 
-	cachedMapForAllStates.add({{c, s}, ptr});
+	cachedMapForAllStates[key] = { c, ptr };
 
 	jassert(animator != nullptr);
 
@@ -999,17 +1132,26 @@ bool StyleSheet::Collection::clearCache(Component* c)
 	{
 		c = simple_css::FlexboxComponent::Helpers::getComponentForStyleSheet(c);
 
-		for(int i = 0; i < cachedMaps.size(); i++)
+		auto found = false;
+
+		for(auto it = cachedMaps.begin(); it != cachedMaps.end();)
 		{
-			if(cachedMaps[i].first.getComponent() == c)
-			{
+			auto cc = it->second.first.getComponent();
 
-				cachedMaps.remove(i);
-				return true;
+			if(cc == nullptr || cc == c)
+			{
+				found |= cc != nullptr;
+				it = cachedMaps.erase(it);
+				continue;
 			}
+
+			if(c->isParentOf(cc))
+				it->second.dirty = true;
+
+			++it;
 		}
 
-		return false;
+		return found;
 	}
 }
 
@@ -1126,22 +1268,10 @@ void StyleSheet::Collection::addCollectionForComponent(Component* c, const Colle
 
 void StyleSheet::Collection::updateStyleSheetInCache(Component* component, const Ptr& ss)
 {
-	for(auto& cd: cachedMaps)
-	{
-		if(cd.first == component)
-		{
-			cd.second = ss;
-			break;
-		}
-	}
+	auto existing = cachedMaps.find(component);
 
-	for(auto cd: cachedMapForAllStates)
-	{
-		if(cd.first.first == component)
-		{
-			cd.second = ss;
-		}
-	}
+	if(existing != cachedMaps.end() && existing->second.first == component)
+		existing->second.second = ss;
 
 	simple_css::FlexboxComponent* rootFb = component->findParentComponentOfClass<FlexboxComponent>();
 
@@ -1284,14 +1414,16 @@ void StyleSheet::Collection::forEach(Component* c, const std::function<void(Ptr)
 
 	for(const auto& e: cachedMaps)
 	{
-		if(e.first != nullptr && (c == nullptr || sameOrParent(c, e.first)))
-			f(e.second);
+		const auto& cs = e.second;
+
+		if(cs.first != nullptr && cs.second != nullptr && (c == nullptr || sameOrParent(c, cs.first)))
+			f(cs.second);
 	}
 
 	for(const auto& e: cachedMapForAllStates)
 	{
-		if(c == nullptr || sameOrParent(c, e.first.first))
-			f(e.second);
+		if(c == nullptr || sameOrParent(c, e.second.first))
+			f(e.second.second);
 	}
 }
 
@@ -85,6 +85,9 @@ struct StyleSheet: public ReferenceCountedObject
 
 		MarkdownLayout::StyleData getMarkdownStyleData(Component* c);
 
+		/** Clears the cached style sheets. If a component is passed in, only the style sheet of this component
+		    is removed and the style sheets of its children are marked as dirty because they inherit the properties
+		    and depend on the selectors of the parent hierarchy. */
 		bool clearCache(Component* c = nullptr);
 
 #if HISE_INCLUDE_CSS_DEBUG_TOOLS
@@ -129,14 +132,46 @@ struct StyleSheet: public ReferenceCountedObject
 		
 		NamedValueSet rootProperties;
 
+		/** Buckets the complex selectors of a list by an ID, class or type selector that a component must
+		    have in order to match, so that getForComponent() only needs to test the relevant selectors. */
+		struct SelectorIndex
+		{
+			struct Entry
+			{
+				int order;
+				ComplexSelector::Ptr selector;
+				StyleSheet::Ptr styleSheet;
+			};
+
+			/** Rebuilds the index if the list has changed since the last call. */
+			void update(const List& l);
+
+			/** Adds all entries that might match the given selectors to the list (sorted by their order in the style sheet). */
+			void addCandidates(const Array<Selector>& componentSelectors, Array<Entry>& candidates) const;
+
+			/** The last style sheet with a * selector. */
+			StyleSheet::Ptr all;
+
+		private:
+
+			static Selector getKeySelector(const ComplexSelector& cs);
+
+			List indexedList;
+			Array<Entry> universalEntries;
+			std::map<String, Array<Entry>> buckets;
+		};
+
 		struct ChildCollection
 		{
 			Component::SafePointer<Component> first;
 			List second;
 			String filename;
 			NamedValueSet childProperties;
+			SelectorIndex index;
 		};
 
+		SelectorIndex rootIndex;
+
 		Array<ChildCollection> childCollections;
 
 #if HISE_INCLUDE_CSS_DEBUG_TOOLS
@@ -162,13 +197,18 @@ struct StyleSheet: public ReferenceCountedObject
             Component::SafePointer<Component> first;
             StyleSheet::Ptr second;
 
+			// set when a parent was invalidated, the style sheet will be recreated with the same variables.
+			bool dirty = false;
+
 #if HISE_INCLUDE_CSS_DEBUG_TOOLS
             String debugLog;
 #endif
         };
+
+		using AllStatesKey = std::pair<Component*, std::pair<int, String>>;
         
-		Array<std::pair<std::pair<Component::SafePointer<Component>, Selector>, StyleSheet::Ptr>> cachedMapForAllStates;
-		Array<CachedStyleSheet> cachedMaps;
+		std::map<AllStatesKey, std::pair<Component::SafePointer<Component>, StyleSheet::Ptr>> cachedMapForAllStates;
+		std::map<Component*, CachedStyleSheet> cachedMaps;
 
 		Animator* animator = nullptr;
 
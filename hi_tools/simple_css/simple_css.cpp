@@ -56,9 +56,10 @@ struct CssTestSuite: public UnitTest
 	void runTest() override
 	{
 		testSelectors();
+		testSelectorIndex();
 		testParser();
 		testValueParsers();
-		
+		testCollectionPerformance();
 	}
 
 	template <typename ComponentType=Component>
@@ -258,6 +259,104 @@ struct CssTestSuite: public UnitTest
 
 	}
 
+	static String createLargeStyleSheet(int numRules)
+	{
+		String code;
+
+		for(int i = 0; i < numRules; i++)
+		{
+			code << ".class" << String(i) << " { background: green; color: white; }\n";
+			code << ".parent" << String(i % 16) << " .class" << String(i) << ":hover { background: blue; }\n";
+			code << "#id" << String(i) << " { margin: 2px; }\n";
+		}
+
+		return code;
+	}
+
+	void testSelectorIndex()
+	{
+		beginTest("testing indexed selector matching");
+
+		auto largeSheet = createLargeStyleSheet(500);
+
+		expectSelectorRed<>({}, { ".class12" }, largeSheet + ".class12 { background: red; }");
+		expectSelectorRed<>({}, { "#id12" }, largeSheet + "#id12 { background: red; }");
+		expectSelectorRed<>({ ".parent3" }, { ".class3" }, largeSheet + ".parent3 .class3 { background: red; }");
+		expectSelectorRed<TextButton>({}, { ".class12" }, largeSheet + "button.class12 { background: red; }");
+		expectSelectorRed<TextButton>({}, { ".class12" }, "button { background: green; }" + largeSheet + "* { background: red; }");
+
+		// specificity and order must not depend on the bucket of the selector
+		expectSelectorRed<>({}, { ".class1", "#id1" }, largeSheet + "#id1 { background: red; } .class1 { background: green; }");
+		expectSelectorRed<>({}, { ".b", ".a" }, ".a { background: green; } .b { background: red; }");
+		expectSelectorRed<>({}, { ".a", ".b" }, ".b { background: green; } .a { background: red; }");
+		expectSelectorRed<>({}, { ".a", ".b" }, ".a.b { background: red; } .b { background: green; }");
+
+		beginTest("testing cache invalidation");
+
+		auto parent = createComponentWithSelectors<>({ ".parent1" });
+		auto c = createComponentWithSelectors<>({ ".child" });
+		parent->addChildComponent(c.get());
+
+		auto css = parse(".parent1 .child { background: red; } .parent2 .child { background: green; }");
+
+		auto ss = css.getForComponent(c.get());
+		expect(ss != nullptr && ss->getColourOrGradient({}, { "background", {}}).first == Colours::red, "parent1 not applied");
+		expect(ss == css.getForComponent(c.get()), "not cached");
+
+		FlexboxComponent::Helpers::writeSelectorsToProperties(*parent, { ".parent2" });
+		css.clearCache(parent.get());
+
+		ss = css.getForComponent(c.get());
+		expect(ss != nullptr && ss->getColourOrGradient({}, { "background", {}}).first == Colours::green, "child not invalidated");
+	}
+
+	void testCollectionPerformance()
+	{
+		beginTest("testing style sheet collection performance");
+
+		const int numComponents = 400;
+		auto css = parse(createLargeStyleSheet(1000));
+
+		Animator animator;
+		css.setAnimator(&animator);
+
+		Component root;
+		OwnedArray<Component> parents;
+		OwnedArray<Component> children;
+
+		for(int i = 0; i < 16; i++)
+		{
+			auto p = parents.add(createComponentWithSelectors<>({ ".parent" + String(i) }).release());
+			root.addChildComponent(p);
+		}
+
+		for(int i = 0; i < numComponents; i++)
+		{
+			auto c = children.add(createComponentWithSelectors<>({ ".class" + String(i * 2), "#id" + String(i) }).release());
+			parents[i % 16]->addChildComponent(c);
+		}
+
+		auto resolveAll = [&]()
+		{
+			auto start = Time::getMillisecondCounterHiRes();
+
+			for(auto c: children)
+				expect(css.getForComponent(c) != nullptr, "no style sheet");
+
+			return Time::getMillisecondCounterHiRes() - start;
+		};
+
+		auto uncached = resolveAll();
+		auto cached = resolveAll();
+
+		css.clearCache(parents[0]);
+		auto invalidated = resolveAll();
+
+		logMessage("Resolving " + String(numComponents) + " components with 3000 rules: " + String(uncached, 2) + "ms");
+		logMessage("Cached lookup: " + String(cached, 2) + "ms");
+		logMessage("Lookup after parent invalidation: " + String(invalidated, 2) + "ms");
+	}
+
 	void testValueParsers()
 	{
 		beginTest("Testing colour parser");
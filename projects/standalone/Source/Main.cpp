@@ -191,6 +191,16 @@ public:
 		print("The additional flag -dump_module_tree will add a JSON object of the HISE module tree to the JSON output");
 		print("(Use the --verbose flag to include all parameter values)");
 		print("");
+		print("benchmark -p:PATH -m:MIDI_FILE [-bs:512] [-sr:44100] [-n:1] [-o:OUTPUT_FILE]");
+		print("Loads the given file (either .xml file or .hip file), renders the MIDI file offline and prints");
+		print("the performance data (block timings, voice count, streaming load, memory) as JSON.");
+		print(" -bs:X,Y - a comma separated list of block sizes that should be rendered");
+		print(" -sr:X,Y - a comma separated list of sample rates that should be rendered");
+		print(" -n:X - the number of repetitions for each setting");
+		print(" -o:PATH - writes the JSON output to the given file instead of the console");
+		print("If HISE was built with HISE_INCLUDE_PROFILING_TOOLKIT, the output also contains the timings");
+		print("for each module.");
+		print("");
 		print("compile_networks -c:CONFIG");
 		print("Compiles the DSP networks in the given project folder. Use the -c flag to specify the build");
 		print("configuration ('Debug' or 'Release')");
@@ -579,6 +589,53 @@ return 0;
 		exporter.threadFinished();
 	}
 
+	static void runBenchmark(const String& commandLine)
+	{
+		auto args = getCommandLineArgs(commandLine);
+
+		auto midiFile = getFilePathArgument(args, File::getCurrentWorkingDirectory(), "-m:");
+
+		if (!midiFile.existsAsFile())
+			throwErrorAndQuit("You need to supply a MIDI file with the -m: argument");
+
+		auto options = HiseBenchmarkRunner::Options::fromCommandLineArguments(getArgument(args, "-bs:"),
+		                                                                      getArgument(args, "-sr:"),
+		                                                                      getArgument(args, "-n:"));
+
+		options.midiFile = midiFile;
+
+		auto outputPath = getArgument(args, "-o:");
+
+		auto ok = loadPresetFile(commandLine, [options, outputPath](BackendProcessor* bp)
+		{
+			HiseBenchmarkRunner runner(bp);
+
+			auto r = runner.run(options);
+
+			if (r.failed())
+				return r;
+
+			if (outputPath.isNotEmpty())
+			{
+				auto outputFile = File::getCurrentWorkingDirectory().getChildFile(outputPath);
+
+				if (!outputFile.replaceWithText(runner.toJSONString()))
+					return Result::fail("Can't write to " + outputFile.getFullPathName());
+
+				print("Wrote benchmark results to " + outputFile.getFullPathName());
+			}
+			else
+			{
+				print(runner.toJSONString());
+			}
+
+			return Result::ok();
+		});
+
+		if (ok != 0)
+			exit(ok);
+	}
+
 	static void startServer(const String& commandLine)
 	{
 		auto args = getCommandLineArgs(commandLine);
@@ -1708,6 +1765,12 @@ public:
 			quit();
 			return;
 		}
+		else if (commandLine.startsWith("benchmark"))
+		{
+			CommandLineActions::runBenchmark(commandLine);
+			quit();
+			return;
+		}
 		else if (commandLine.startsWith("compile_networks"))
 		{
 			CommandLineActions::compileNetworks(commandLine);